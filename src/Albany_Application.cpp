@@ -11,6 +11,7 @@
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_ResponseFactory.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "Albany_TpetraThyraUtils.hpp"
 #include "Albany_Utils.hpp"
 #include "Thyra_MultiVectorStdOps.hpp"
 #include "Thyra_VectorBase.hpp"
@@ -30,6 +31,8 @@
 #include "Albany_ScalarResponseFunction.hpp"
 #include "PHAL_Utilities.hpp"
 #include "Albany_KokkosUtils.hpp"
+#include "Albany_Memory.hpp"
+#include "Phalanx_Print.hpp"
 
 //#define WRITE_TO_MATRIX_MARKET
 //#define DEBUG_OUTPUT
@@ -160,6 +163,7 @@ Application::initialSetUp(const RCP<Teuchos::ParameterList>& params)
   // Initialize Phalanx postRegistration setup
   phxSetup = Teuchos::rcp(new PHAL::Setup());
   phxSetup->init_problem_params(problemParams);
+  scratchArena = Teuchos::rcp(new PHAL::ScratchArena());
 
   // Pull the number of solution vectors out of the problem and send them to the
   // discretization list, if the user specifies this in the problem
@@ -178,6 +182,12 @@ Application::initialSetUp(const RCP<Teuchos::ParameterList>& params)
   else
     num_time_deriv = num_time_deriv_from_input;
 
+  // The Auto workset size cost model needs the number of equations, which
+  // the problem may already know at this point (if not, the model assumes 1)
+  if (!discParams.isParameter("Workset Cost Model Equations") &&
+      discParams.get<std::string>("Workset Size Policy", "Fixed") == "Auto")
+    discParams.set<int>("Workset Cost Model Equations", problem->numEquations());
+
   TEUCHOS_TEST_FOR_EXCEPTION(
       num_time_deriv > 2,
       std::logic_error,
@@ -485,6 +495,11 @@ Application::buildProblem()
 
   neq               = problem->numEquations();
   spatial_dimension = problem->spatialDimension();
+  jacobianFillEquations = neq;
+
+  // Coordinates are copied to device on first use
+  wsCoordsViews.clear();
+  wsCoordsRevision = -1;
 
   // Construct responses
   // This really needs to happen after the discretization is created for
@@ -531,6 +546,8 @@ Application::buildProblem()
 void
 Application::createDiscretization()
 {
+  MemoryPhase memoryPhase("Discretization");
+
   // Create the full mesh
   disc = discFactory->createDiscretization(
       neq,
@@ -542,6 +559,9 @@ Application::createDiscretization()
       problem->getNullSpace());
   // The following is for Aeras problems.
   explicit_scheme = disc->isExplicitScheme();
+
+  // Let evaluators resolve their side sets once, in postRegistrationSetup
+  phxSetup->init_side_set_ids(disc->getSideSetIds());
 }
 
 void
@@ -577,6 +597,25 @@ Application::setScaling(const Teuchos::RCP<Teuchos::ParameterList>& params)
 
   if (scale == 1.0) scaleBCdofs = false;
 
+  // Lagged DIAG/ABSROWSUM scaling: by default, recompute it at every Jacobian
+  scaleRecomputeInterval = scalingParams->get<int>("Recompute Interval", 1);
+  scaleRecomputeTol      = scalingParams->get<double>("Recompute Tolerance", -1.0);
+  numScaledJacobians     = 0;
+  scaleSampledNorm       = -1.0;
+  if (scale_type != CONSTANT && !scaleBCdofs) {
+    *out << "Jacobian/residual scaling (" << scaleType << ") recomputed ";
+    if (scaleRecomputeInterval > 0) {
+      *out << "every " << scaleRecomputeInterval << " Jacobian(s)";
+    } else {
+      *out << "at the first Jacobian";
+    }
+    if (scaleRecomputeTol > 0.0) {
+      *out << ", or when the sampled row norm changes by more than "
+           << scaleRecomputeTol << " (relative)";
+    }
+    *out << ".\n";
+  }
+
   if ((scale != 1.0) && (problem->useSDBCs() == true)) {
     TEUCHOS_TEST_FOR_EXCEPTION(
         true,
@@ -713,6 +752,8 @@ Application::finalSetUp(
 
   is_adjoint = problemParams->get("Solve Adjoint", false);
 
+  setupJacobianPasses();
+
   // For backward compatibility, use any value at the old location of the
   // "Compute Sensitivity" flag as a default value for the new flag location
   // when the latter has been left undefined
@@ -1031,6 +1072,8 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
   std::string evalName = PHAL::evalName<EvalT>("FM",0);
   if (phxSetup->contain_eval(evalName)) return;
 
+  MemoryPhase memoryPhase("Field Managers: " + PHX::print<EvalT>());
+
   for (int ps = 0; ps < fm.size(); ps++) {
     evalName = PHAL::evalName<EvalT>("FM",ps);
     phxSetup->insert_eval(evalName);
@@ -1105,6 +1148,8 @@ Application::postRegSetupDImpl()
   std::string evalName = PHAL::evalName<EvalT>("FM",0);
   if (phxSetup->contain_eval(evalName)) return;
 
+  MemoryPhase memoryPhase("Field Managers: " + PHX::print<EvalT>());
+
   for (int ps = 0; ps < fm.size(); ps++) {
     evalName = PHAL::evalName<EvalT>("FM",ps);
     phxSetup->insert_eval(evalName);
@@ -1400,6 +1445,67 @@ Application::computeGlobalResidual(
   }
 }
 
+void
+Application::setupJacobianPasses()
+{
+  jacobianPasses.clear();
+  jacobianFillEquations = neq;
+  if (!problemParams->isParameter("Jacobian Equation Blocks")) { return; }
+
+  // Problem-specific gathers, scatters and evaluators assume that all the
+  // equations are seeded, and would index the derivatives out of bounds
+  TEUCHOS_TEST_FOR_EXCEPTION (!problem->supportsJacobianPasses(), std::logic_error,
+      "Error! Problem '" << problemParams->get<std::string>("Name") << "' does not support "
+      "'Jacobian Equation Blocks' (see AbstractProblem::supportsJacobianPasses).\n");
+
+  // Each block is a contiguous range of equations, given by its first
+  // equation. The residual of block k may depend on the blocks in
+  // [coupling[k],k] only (by default, on block k only).
+  const auto blocks = problemParams->get<Teuchos::Array<int>>("Jacobian Equation Blocks");
+  const int numBlocks = blocks.size();
+  Teuchos::Array<int> coupling(numBlocks);
+  for (int k = 0; k < numBlocks; ++k) { coupling[k] = k; }
+  coupling = problemParams->get("Jacobian Block Coupling", coupling);
+
+  TEUCHOS_TEST_FOR_EXCEPTION (numBlocks == 0 || blocks[0] != 0, std::logic_error,
+      "Error! 'Jacobian Equation Blocks' must start with equation 0.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (coupling.size() != numBlocks, std::logic_error,
+      "Error! 'Jacobian Block Coupling' must have one entry per equation block.\n");
+
+  for (int k = 0; k < numBlocks; ++k) {
+    const int end = k+1 < numBlocks ? blocks[k+1] : static_cast<int>(neq);
+    TEUCHOS_TEST_FOR_EXCEPTION (end <= blocks[k], std::logic_error,
+        "Error! 'Jacobian Equation Blocks' must be strictly increasing, and smaller than the number of equations.\n");
+    TEUCHOS_TEST_FOR_EXCEPTION (coupling[k] < 0 || coupling[k] > k, std::logic_error,
+        "Error! Block " << k << " can only be coupled with blocks in [0," << k << "].\n");
+
+    PHAL::JacobianPass pass;
+    pass.col_begin = blocks[coupling[k]];
+    pass.col_end   = end;
+    pass.row_begin = blocks[k];
+    pass.row_end   = end;
+    jacobianPasses.push_back(pass);
+  }
+
+  int maxColEqs = 0;
+  for (const auto& pass : jacobianPasses) {
+    maxColEqs = std::max(maxColEqs, pass.numColEqs(neq));
+  }
+
+  if (maxColEqs == static_cast<int>(neq)) {
+    // Some pass needs all the derivatives: a single pass is cheaper
+    *out << "Jacobian Equation Blocks: some block is coupled with all the equations; "
+         << "using a single pass for the Jacobian fill.\n";
+    jacobianPasses.clear();
+    return;
+  }
+
+  jacobianFillEquations = maxColEqs;
+  *out << "Jacobian Equation Blocks: filling the Jacobian in " << jacobianPasses.size()
+       << " passes, with at most " << jacobianFillEquations << " (out of " << neq
+       << ") equations per pass.\n";
+}
+
 void
 Application::computeGlobalJacobianImpl(
     const double                            alpha,
@@ -1493,16 +1599,26 @@ Application::computeGlobalJacobianImpl(
       workset.Jac_kokkos = getNonconstDeviceData(workset.Jac);
     }
 #endif
-    for (int ws = 0; ws < numWorksets; ws++) {
-      const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
-      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
-
-      // FillType template argument used to specialize Sacado
-      fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
-      if (Teuchos::nonnull(nfm))
-        deref_nfm(nfm, wsPhysIndex, ws)
-            ->evaluateFields<EvalT>(workset);
+    // If the problem declared equation blocks, each pass seeds and scatters
+    // only some equations, so that the FAD types are smaller. Each entry of
+    // the Jacobian (and of the residual) is only summed into by one pass.
+    const int numPasses = std::max(static_cast<int>(jacobianPasses.size()), 1);
+    for (int pass = 0; pass < numPasses; ++pass) {
+      workset.jacobian_pass =
+          jacobianPasses.empty() ? PHAL::JacobianPass() : jacobianPasses[pass];
+
+      for (int ws = 0; ws < numWorksets; ws++) {
+        const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+        loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+
+        // FillType template argument used to specialize Sacado
+        fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+        if (Teuchos::nonnull(nfm))
+          deref_nfm(nfm, wsPhysIndex, ws)
+              ->evaluateFields<EvalT>(workset);
+      }
     }
+    workset.jacobian_pass = PHAL::JacobianPass();
   }
 
   // This will also assemble global jacobian (i.e., do import/export)
@@ -1518,6 +1634,7 @@ Application::computeGlobalJacobianImpl(
       scaleVec_ = Thyra::createMember(jac->range());
       scaleVec_->assign(0.0);
       setScale();
+      scaleSampledNorm = -1.0;
     }
   }
 
@@ -1534,15 +1651,28 @@ Application::computeGlobalJacobianImpl(
       writeMatrixMarket(f, "resUnscaled", countScale);
     }
 #endif
-    // set the scaling
-    setScale(jac);
+    auto tpetra_jac = getTpetraMatrix(jac, false);
+    if (scale_type != CONSTANT && Teuchos::nonnull(tpetra_jac)) {
+      // Lagged scaling. When recomputed, the scaling vector is computed
+      // and applied to the Jacobian in a single pass over the matrix.
+      if (needScaleRecompute(jac)) {
+        ComputeScalingAndLeftScale(
+            getTpetraVector(scaleVec_), tpetra_jac, scale_type == DIAG);
+      } else {
+        LeftScale(tpetra_jac, getConstTpetraVector(scaleVec_.getConst()));
+      }
+      ++numScaledJacobians;
+    } else {
+      // set the scaling
+      setScale(jac);
 
-    // scale Jacobian
-    // We MUST be able to cast jac to ScaledLinearOpBase in order to left
-    // scale it.
-    auto jac_scaled_lop =
-        Teuchos::rcp_dynamic_cast<Thyra::ScaledLinearOpBase<ST>>(jac, true);
-    jac_scaled_lop->scaleLeft(*scaleVec_);
+      // scale Jacobian
+      // We MUST be able to cast jac to ScaledLinearOpBase in order to left
+      // scale it.
+      auto jac_scaled_lop =
+          Teuchos::rcp_dynamic_cast<Thyra::ScaledLinearOpBase<ST>>(jac, true);
+      jac_scaled_lop->scaleLeft(*scaleVec_);
+    }
     // scale residual
     /*IKTif (Teuchos::nonnull(f)) {
       Thyra::ele_wise_scale<ST>(*scaleVec_,f.ptr());
@@ -1630,6 +1760,8 @@ Application::computeGlobalJacobian(
     const Teuchos::RCP<Thyra_LinearOp>&     jac,
     const double                            dt)
 {
+  MemoryPhase memoryPhase("Jacobian Fill");
+
   this->computeGlobalJacobianImpl(
       alpha, beta, omega, current_time, x, xdot, xdotdot, p, f, jac, dt);
   // Debut output
@@ -2911,18 +3043,48 @@ Application::setScale(Teuchos::RCP<const Thyra_LinearOp> jac)
       scaleVec_->assign(1.0);
     } else {
       scaleVec_->assign(0.0);
-      // We MUST be able to cast the linear op to RowStatLinearOpBase, in order
-      // to get row informations
-      auto jac_row_stat =
-          Teuchos::rcp_dynamic_cast<const Thyra::RowStatLinearOpBase<ST>>(
-              jac, true);
+      auto tpetra_jac = getConstTpetraMatrix(jac, false);
+      if (Teuchos::nonnull(tpetra_jac)) {
+        // Thread-parallel row sums on the local matrix
+        InvAbsRowSum(getTpetraVector(scaleVec_), tpetra_jac);
+      } else {
+        // We MUST be able to cast the linear op to RowStatLinearOpBase, in order
+        // to get row informations
+        auto jac_row_stat =
+            Teuchos::rcp_dynamic_cast<const Thyra::RowStatLinearOpBase<ST>>(
+                jac, true);
+
+        // Compute the inverse of the absolute row sum
+        jac_row_stat->getRowStat(
+            Thyra::RowStatLinearOpBaseUtils::ROW_STAT_INV_ROW_SUM,
+            scaleVec_.ptr());
+      }
+    }
+  }
+}
 
-      // Compute the inverse of the absolute row sum
-      jac_row_stat->getRowStat(
-          Thyra::RowStatLinearOpBaseUtils::ROW_STAT_INV_ROW_SUM,
-          scaleVec_.ptr());
+bool
+Application::needScaleRecompute(const Teuchos::RCP<const Thyra_LinearOp>& jac)
+{
+  // Number of rows per rank used to detect changes in the Jacobian
+  constexpr int numSampledRows = 64;
+
+  bool recompute = scaleSampledNorm < 0.0 ||
+                   (scaleRecomputeInterval > 0 &&
+                    numScaledJacobians % scaleRecomputeInterval == 0);
+  if (scaleRecomputeTol > 0.0) {
+    const ST norm =
+        SampledAbsRowSumNorm(getConstTpetraMatrix(jac), numSampledRows);
+    if (!recompute) {
+      recompute = std::abs(norm - scaleSampledNorm) >
+                  scaleRecomputeTol * std::abs(scaleSampledNorm);
     }
+    if (recompute) { scaleSampledNorm = norm; }
+  } else if (recompute) {
+    scaleSampledNorm = 0.0;
   }
+
+  return recompute;
 }
 
 void
@@ -2944,15 +3106,21 @@ Application::setScaleBCDofs(
     getDiagonalCopy(jac, tmp);
     scale = tmp->norm_inf();
   } else if (scale_type == ABSROWSUM) {
-    // We MUST be able to cast the linear op to RowStatLinearOpBase, in order to
-    // get row informations
-    auto jac_row_stat =
-        Teuchos::rcp_dynamic_cast<const Thyra::RowStatLinearOpBase<ST>>(
-            jac, true);
-
-    // Compute the absolute row sum
-    jac_row_stat->getRowStat(
-        Thyra::RowStatLinearOpBaseUtils::ROW_STAT_ROW_SUM, tmp.ptr());
+    auto tpetra_jac = getConstTpetraMatrix(jac, false);
+    if (Teuchos::nonnull(tpetra_jac)) {
+      // Thread-parallel row sums on the local matrix
+      AbsRowSum(getTpetraVector(tmp), tpetra_jac);
+    } else {
+      // We MUST be able to cast the linear op to RowStatLinearOpBase, in order to
+      // get row informations
+      auto jac_row_stat =
+          Teuchos::rcp_dynamic_cast<const Thyra::RowStatLinearOpBase<ST>>(
+              jac, true);
+
+      // Compute the absolute row sum
+      jac_row_stat->getRowStat(
+          Thyra::RowStatLinearOpBaseUtils::ROW_STAT_ROW_SUM, tmp.ptr());
+    }
     scale = tmp->norm_inf();
   }
 
@@ -3027,6 +3195,42 @@ Application::loadWorksetSidesetInfo(PHAL::Workset& workset, const int ws)
 {
   workset.sideSets = Teuchos::rcpFromRef(disc->getSideSets(ws));
   workset.sideSetViews = Teuchos::rcpFromRef(disc->getSideSetViews(ws));
+  workset.indexedSideSets = Teuchos::rcpFromRef(disc->getIndexedSideSets(ws));
+  workset.indexedSideSetViews = Teuchos::rcpFromRef(disc->getIndexedSideSetViews(ws));
+}
+
+Kokkos::View<const RealType***, PHX::Device>
+Application::getWsCoordsView(const int ws)
+{
+  auto const& coords = disc->getCoords();
+
+  // If coordinates changed, all copies are stale
+  if (wsCoordsRevision != disc->getCoordsRevision() ||
+      wsCoordsViews.size() != static_cast<size_t>(coords.size())) {
+    wsCoordsViews.clear();
+    wsCoordsViews.resize(coords.size());
+    wsCoordsRevision = disc->getCoordsRevision();
+  }
+
+  auto& view = wsCoordsViews[ws];
+  if (view.size() == 0 && coords[ws].size() > 0) {
+    const int numCells = coords[ws].size();
+    const int numNodes = coords[ws][0].size();
+    const int numDim   = disc->getNumDim();
+
+    view = Kokkos::View<RealType***, PHX::Device>(
+        "wsCoords_" + std::to_string(ws), numCells, numNodes, numDim);
+    auto view_host = Kokkos::create_mirror_view(view);
+    for (int cell = 0; cell < numCells; ++cell) {
+      for (int node = 0; node < numNodes; ++node) {
+        for (int dim = 0; dim < numDim; ++dim) {
+          view_host(cell, node, dim) = coords[ws][cell][node][dim];
+        }
+      }
+    }
+    Kokkos::deep_copy(view, view_host);
+  }
+  return view;
 }
 
 void
@@ -31,6 +31,7 @@
 
 #include <set>
 #include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_ScratchArena.hpp"
 #include "PHAL_Setup.hpp"
 #include "PHAL_Workset.hpp"
 
@@ -154,6 +155,14 @@ public:
   {
     return neq;
   }
+  //! Number of equations whose derivatives are seeded in one pass of the
+  //! Jacobian fill (less than getNumEquations() if the problem declared
+  //! "Jacobian Equation Blocks")
+  int
+  getJacobianFillEquations() const
+  {
+    return jacobianFillEquations;
+  }
   int
   getSpatialDimension() const
   {
@@ -1035,6 +1044,11 @@ void
   void
   loadWorksetSidesetInfo(PHAL::Workset& workset, const int ws);
 
+  //! Device copy of the coordinates of workset ws (filled on first use,
+  //! and refilled only when the discretization coordinates change)
+  Kokkos::View<const RealType***, PHX::Device>
+  getWsCoordsView(const int ws);
+
   //! Routines for setting a scaling to be applied to the Jacobian/resdiual
   void
   setScale(Teuchos::RCP<const Thyra_LinearOp> jac = Teuchos::null);
@@ -1043,6 +1057,14 @@ void
       PHAL::Workset&                     workset,
       Teuchos::RCP<const Thyra_LinearOp> jac = Teuchos::null);
 
+  //! Whether the (lagged) DIAG/ABSROWSUM scaling must be recomputed from the (unscaled) jac
+  bool
+  needScaleRecompute(const Teuchos::RCP<const Thyra_LinearOp>& jac);
+
+  //! Build the passes of the Jacobian fill from "Jacobian Equation Blocks"
+  void
+  setupJacobianPasses();
+
   void
   setupBasicWorksetInfo(
       PHAL::Workset&                          workset,
@@ -1202,6 +1224,15 @@ void
   };
   SCALETYPE scale_type;
 
+  //! Recompute the DIAG/ABSROWSUM scaling every this many Jacobians (<=0: never, unless the tolerance triggers it)
+  int scaleRecomputeInterval;
+  //! Recompute the scaling if a sampled row-norm changes more than this (relative; <=0: no check)
+  double scaleRecomputeTol;
+  //! Number of Jacobians scaled with the lagged policy
+  int numScaledJacobians;
+  //! Sampled row-norm of the Jacobian used for the current scaling (negative: no scaling computed yet)
+  double scaleSampledNorm;
+
   //! Shape Optimization data
   bool                     shapeParamsHaveBeenReset;
   std::vector<RealType>    shapeParams;
@@ -1209,8 +1240,21 @@ void
 
   unsigned int neq, spatial_dimension, tangent_deriv_dim;
 
+  //! Passes of the Jacobian fill (empty: a single pass over all equations)
+  std::vector<PHAL::JacobianPass> jacobianPasses;
+  //! Max number of equations seeded in a pass of the Jacobian fill
+  int jacobianFillEquations;
+
+  //! Per-workset device copies of the coordinates, and the discretization
+  //! coordinates revision they were filled from
+  std::vector<Kokkos::View<RealType***, PHX::Device>> wsCoordsViews;
+  int wsCoordsRevision;
+
   //! Phalanx postRegistration data
   Teuchos::RCP<PHAL::Setup> phxSetup;
+
+  //! Scratch memory of the evaluators, shared by all field managers
+  Teuchos::RCP<PHAL::ScratchArena> scratchArena;
   mutable int               phxGraphVisDetail;
   mutable int               stateGraphVisDetail;
 
@@ -1261,12 +1305,17 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, const int& ws,
   workset.wsElNodeEqID         = wsElNodeEqID[ws];
   workset.wsElNodeID           = wsElNodeID[ws];
   workset.wsCoords             = coords[ws];
+  workset.wsCoordsView         = getWsCoordsView(ws);
   workset.EBName               = wsEBNames[ws];
   workset.wsIndex              = ws;
 
   workset.local_Vp.resize(workset.numCells);
 
-  workset.savedMDFields = phxSetup->get_saved_fields(evalName);
+  workset.savedMDFields = phxSetup->get_saved_fields(evalName, ws);
+
+  // Temporaries of the previous workset are no longer needed
+  scratchArena->reset();
+  workset.scratch = scratchArena;
 
   //  workset.print(*out);
 
@@ -0,0 +1,143 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MATRIX_FREE_JACOBIAN_OP_HPP
+#define ALBANY_MATRIX_FREE_JACOBIAN_OP_HPP
+
+#include "Albany_Application.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+#include "Thyra_MultiVectorStdOps.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace Albany {
+
+  //! Thyra_LinearOp implementing the action of W = alpha*df/dxdot + beta*df/dx + omega*df/dxdotdot
+  /*!
+   * This class implements the Thyra::LinearOpBase interface for W*v,
+   * without ever assembling W. Each apply() runs a Tangent fill of the
+   * Albany residual, using v as seed direction for x (and xdot/xdotdot),
+   * so that ScatterResidual<Tangent> returns W*v exactly (no finite
+   * differences are involved).
+   */
+  class MatrixFreeJacobianOp : public Thyra_LinearOp {
+  public:
+
+    // Constructor
+    MatrixFreeJacobianOp(const Teuchos::RCP<Application>& app_) :
+      app(app_),
+      alpha(0.0),
+      beta(1.0),
+      omega(0.0),
+      time(0.0) {}
+
+    //! Destructor
+    virtual ~MatrixFreeJacobianOp() {}
+
+    //! Set values needed for apply()
+    void set(const double alpha_,
+             const double beta_,
+             const double omega_,
+             const double time_,
+             const Teuchos::RCP<const Thyra_Vector>& x_,
+             const Teuchos::RCP<const Thyra_Vector>& xdot_,
+             const Teuchos::RCP<const Thyra_Vector>& xdotdot_,
+             const Teuchos::RCP<Teuchos::Array<ParamVec> >& scalar_params_) {
+      alpha = alpha_;
+      beta = beta_;
+      omega = omega_;
+      time = time_;
+      xdot = xdot_;
+      xdotdot = xdotdot_;
+      x = x_;
+      scalar_params = scalar_params_;
+    }
+
+    //! Overrides Thyra::LinearOpBase purely virtual method
+    Teuchos::RCP<const Thyra_VectorSpace> domain() const {
+      return app->getVectorSpace();
+    }
+
+    //! Overrides Thyra::LinearOpBase purely virtual method
+    Teuchos::RCP<const Thyra_VectorSpace> range() const {
+      return app->getVectorSpace();
+    }
+
+    //@}
+
+  protected:
+    //! Overrides Thyra::LinearOpBase purely virtual method
+    bool opSupportedImpl(Thyra::EOpTransp M_trans) const {
+      // The Tangent evaluation only gives us the forward action
+      return Thyra::real_trans(M_trans) == Thyra::NOTRANS;
+    }
+
+    //! Overrides Thyra::LinearOpBase purely virtual method
+    void applyImpl (const Thyra::EOpTransp M_trans,
+                    const Thyra_MultiVector& X,
+                    const Teuchos::Ptr<Thyra_MultiVector>& Y,
+                    const ST Y_alpha,
+                    const ST Y_beta) const {
+
+      TEUCHOS_TEST_FOR_EXCEPTION (!opSupportedImpl(M_trans), std::logic_error,
+          "Error! MatrixFreeJacobianOp does not support the transpose operator.\n");
+      TEUCHOS_TEST_FOR_EXCEPTION (x.is_null(), std::logic_error,
+          "Error! MatrixFreeJacobianOp::apply called before MatrixFreeJacobianOp::set.\n");
+
+      const Teuchos::RCP<const Thyra_MultiVector> V = Teuchos::rcpFromRef(X);
+      const Teuchos::RCP<Thyra_MultiVector> WV = Thyra::createMembers(range(), X.domain()->dim());
+
+      app->computeGlobalTangent(alpha, beta, omega, time, false,
+                                x, xdot, xdotdot,
+                                *scalar_params, NULL,
+                                V,
+                                Teuchos::nonnull(xdot) ? V : Teuchos::null,
+                                Teuchos::nonnull(xdotdot) ? V : Teuchos::null,
+                                Teuchos::null,
+                                Teuchos::null, WV, Teuchos::null);
+
+      // Y = Y_alpha*W*X + Y_beta*Y
+      if (Y_beta==0.0) {
+        Y->assign(0.0);
+      } else {
+        Thyra::scale(Y_beta, Y);
+      }
+      Thyra::update(Y_alpha, *WV, Y);
+    }
+
+    //! Albany applications
+    Teuchos::RCP<Application> app;
+
+    //! @name Data needed for apply()
+    //@{
+
+    //! Coefficients of df/dxdot, df/dx and df/dxdotdot in W
+    double alpha;
+    double beta;
+    double omega;
+
+    //! Current time
+    double time;
+
+    //! Velocity vector
+    Teuchos::RCP<const Thyra_Vector> xdot;
+
+    //! Acceleration vector
+    Teuchos::RCP<const Thyra_Vector> xdotdot;
+
+    //! Solution vector
+    Teuchos::RCP<const Thyra_Vector> x;
+
+    //! Scalar parameters
+    Teuchos::RCP<Teuchos::Array<ParamVec> > scalar_params;
+
+    //@}
+
+  }; // class MatrixFreeJacobianOp
+
+} // namespace Albany
+
+#endif // ALBANY_MATRIX_FREE_JACOBIAN_OP_HPP
@@ -6,12 +6,22 @@
 
 #include <algorithm>
 #include <vector>
+#include <map>
+#include <fstream>
 #include <sstream>
 #include <iomanip>
 
+#include <unistd.h>
+
 #include <Teuchos_CommHelpers.hpp>
+#include <Kokkos_Core.hpp>
 #include "Albany_Memory.hpp"
 
+// Kokkos Tools callbacks can be set programmatically since Kokkos 3.2
+#if defined(KOKKOS_VERSION) && KOKKOS_VERSION >= 30200
+# define ALBANY_TRACK_KOKKOS_ALLOCATIONS
+#endif
+
 #ifdef ALBANY_HAVE_MALLINFO
 # include <malloc.h>
 #endif
@@ -176,6 +186,52 @@ public:
     os << msg.str();
   }
 };
+
+// Data recorded at the end of a MemoryPhase, in MB
+struct PhaseData {
+  enum { rss = 0, rss_peak, rss_peak_growth, kokkos, kokkos_peak, ndata };
+  double data[ndata] = {0, 0, 0, 0, 0};
+};
+
+struct MemoryPhases {
+  bool enabled = false;
+  bool kokkos_tracked = false;
+
+  // Phase names, in order of first occurrence
+  std::vector<std::string> names;
+  std::map<std::string, PhaseData> phases;
+
+  // Bytes in Kokkos allocations (since tracking started), and their peak
+  long long kokkos_current = 0;
+  long long kokkos_peak = 0;
+
+  // Number of Kokkos allocations (since tracking started)
+  long long kokkos_count = 0;
+};
+
+MemoryPhases& memoryPhases () {
+  static MemoryPhases mp;
+  return mp;
+}
+
+constexpr double MB = 1024.0*1024.0;
+
+#ifdef ALBANY_TRACK_KOKKOS_ALLOCATIONS
+void kokkosAllocate (const Kokkos_Profiling_SpaceHandle, const char*,
+                     const void* const, const uint64_t size) {
+  auto& mp = memoryPhases();
+  ++mp.kokkos_count;
+  mp.kokkos_current += size;
+  mp.kokkos_peak = std::max(mp.kokkos_peak, mp.kokkos_current);
+}
+
+void kokkosDeallocate (const Kokkos_Profiling_SpaceHandle, const char*,
+                       const void* const, const uint64_t size) {
+  // Allocations made before the tracking started are not counted
+  auto& mp = memoryPhases();
+  mp.kokkos_current = std::max(0LL, mp.kokkos_current - static_cast<long long>(size));
+}
+#endif
 } // namespace
 
 void printMemoryAnalysis (
@@ -186,4 +242,166 @@ void printMemoryAnalysis (
   ma.print(os);
 }
 
+double getPeakMemoryUsage ()
+{
+#ifdef ALBANY_HAVE_GETRUSAGE
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+# ifdef __APPLE__
+  // On OSX, ru_maxrss is in bytes
+  return static_cast<double>(ru.ru_maxrss) / (1024.0*1024.0);
+# else
+  // Elsewhere, ru_maxrss is in kilobytes
+  return static_cast<double>(ru.ru_maxrss) / 1024.0;
+# endif
+#else
+  return -1.0;
+#endif
+}
+
+double getCurrentMemoryUsage ()
+{
+  // Second field is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  long long size, resident;
+  if (!(statm >> size >> resident)) return -1.0;
+  return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / MB;
+}
+
+bool trackKokkosAllocations ()
+{
+  auto& mp = memoryPhases();
+#ifdef ALBANY_TRACK_KOKKOS_ALLOCATIONS
+  // Do not override the callbacks of a profiling library
+  if (!mp.kokkos_tracked && Kokkos::is_initialized() &&
+      !Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Tools::Experimental::set_allocate_data_callback(kokkosAllocate);
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(kokkosDeallocate);
+    mp.kokkos_tracked = true;
+  }
+#endif
+  return mp.kokkos_tracked;
+}
+
+long long getKokkosAllocationCount ()
+{
+  return memoryPhases().kokkos_count;
+}
+
+void enableMemoryPhases (const bool enable)
+{
+  memoryPhases().enabled = enable;
+  if (enable) trackKokkosAllocations();
+}
+
+MemoryPhase::MemoryPhase (const std::string& name)
+  : name_(name), active_(memoryPhases().enabled),
+    rss_peak_start_(0), kokkos_peak_outer_(0)
+{
+  if (!active_) return;
+
+  auto& mp = memoryPhases();
+  rss_peak_start_ = getPeakMemoryUsage();
+
+  // The peak of this phase starts from the current usage. The one of the
+  // enclosing phase is restored at the end.
+  kokkos_peak_outer_ = mp.kokkos_peak;
+  mp.kokkos_peak = mp.kokkos_current;
+}
+
+void MemoryPhase::stop ()
+{
+  if (!active_) return;
+  active_ = false;
+
+  auto& mp = memoryPhases();
+  if (mp.phases.find(name_) == mp.phases.end()) {
+    mp.names.push_back(name_);
+  }
+  double* data = mp.phases[name_].data;
+
+  const double rss_peak = getPeakMemoryUsage();
+  data[PhaseData::rss]             = getCurrentMemoryUsage();
+  data[PhaseData::rss_peak]        = rss_peak;
+  data[PhaseData::rss_peak_growth] = rss_peak < 0 ? -1.0 :
+    std::max(data[PhaseData::rss_peak_growth], rss_peak - rss_peak_start_);
+  if (mp.kokkos_tracked) {
+    data[PhaseData::kokkos]      = mp.kokkos_current / MB;
+    data[PhaseData::kokkos_peak] =
+      std::max(data[PhaseData::kokkos_peak], mp.kokkos_peak / MB);
+  } else {
+    data[PhaseData::kokkos] = data[PhaseData::kokkos_peak] = -1.0;
+  }
+
+  mp.kokkos_peak = std::max(mp.kokkos_peak, kokkos_peak_outer_);
+}
+
+void printMemoryPhases (
+  std::ostream& os, const Teuchos::RCP< const Teuchos::Comm<int> >& comm)
+{
+  const auto& mp = memoryPhases();
+  if (!mp.enabled) return;
+
+  // Use the phases of rank 0 (all phases are collective)
+  std::string names;
+  for (const auto& name : mp.names) names += name + '\n';
+  int size = names.size();
+  Teuchos::broadcast<int,int>(*comm, 0, &size);
+  names.resize(size);
+  if (size > 0) Teuchos::broadcast<int,char>(*comm, 0, size, &names[0]);
+
+  std::vector<std::string> phases;
+  std::stringstream ss(names);
+  for (std::string name; std::getline(ss, name); ) phases.push_back(name);
+
+  const int ndata = PhaseData::ndata;
+  const int nphases = phases.size();
+  const int nranks = comm->getSize();
+  std::vector<double> local(std::max(ndata*nphases, 1), -1.0);
+  for (int i = 0; i < nphases; ++i) {
+    const auto it = mp.phases.find(phases[i]);
+    if (it == mp.phases.end()) continue;
+    std::copy(it->second.data, it->second.data + ndata, &local[ndata*i]);
+  }
+  std::vector<double> all;
+  if (comm->getRank() == 0) all.resize(local.size()*nranks);
+  Teuchos::gather<int, double>(&local[0], local.size(), all.data(),
+                               local.size(), 0, *comm);
+  if (comm->getRank() != 0) return;
+
+  static const char* fields[ndata] =
+    {"rss", "rss_peak", "rss_peak_growth", "kokkos", "kokkos_peak"};
+
+  std::stringstream msg;
+  msg << ">>> Albany Memory Phases (MB)" << std::endl;
+  msg << "    #ranks: " << nranks << std::endl;
+  if (!mp.kokkos_tracked)
+    msg << "    Kokkos allocations not tracked" << std::endl;
+  msg << "           field             min proc          median"
+    "             max proc" << std::endl;
+  msg << std::fixed << std::setprecision(1);
+  for (int i = 0; i < nphases; ++i) {
+    msg << "  " << phases[i] << std::endl;
+    for (int j = 0; j < ndata; ++j) {
+      std::vector<double> v(nranks);
+      for (int r = 0; r < nranks; ++r) v[r] = all[local.size()*r + ndata*i + j];
+      const auto min = std::min_element(v.begin(), v.end());
+      const auto max = std::max_element(v.begin(), v.end());
+      // Not available on any rank
+      if (*max < 0) continue;
+      const int min_i = min - v.begin();
+      const int max_i = max - v.begin();
+      const double vmin = *min, vmax = *max;
+      std::nth_element(v.begin(), v.begin() + v.size()/2, v.end());
+      msg << std::setw(16) << fields[j] << " "
+          << std::setw(15) << vmin << " " << std::setw(4) << min_i << " "
+          << std::setw(15) << v[v.size()/2] << " "
+          << std::setw(15) << vmax << " " << std::setw(4) << max_i << " "
+          << std::endl;
+    }
+  }
+  msg << "<<< Albany Memory Phases" << std::endl;
+  os << msg.str();
+}
+
 } // namespace Albany
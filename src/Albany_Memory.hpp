@@ -8,6 +8,7 @@
 #define ALBANY_MEMORY_HPP
 
 #include <iostream>
+#include <string>
 #include <Teuchos_Comm.hpp>
 
 namespace Albany {
@@ -49,6 +50,75 @@ namespace Albany {
  */
 void printMemoryAnalysis(
   std::ostream& os, const Teuchos::RCP< const Teuchos::Comm<int> >& comm);
+
+/*! \brief Peak resident set size of this rank, in MB.
+ *
+ *  Relies on getrusage, so it returns a negative value if Albany was not
+ *  configured with ENABLE_GETRUSAGE=ON.
+ */
+double getPeakMemoryUsage();
+
+/*! \brief Resident set size of this rank, in MB.
+ *
+ *  Read from /proc/self/statm, so it returns a negative value on systems
+ *  without procfs.
+ */
+double getCurrentMemoryUsage();
+
+/*! \brief Phase-scoped memory tracking.
+ *
+ *  With "Analyze Memory" on, Main_Solve enables the tracking, and main phases
+ *  of the run (setup, discretization, field manager allocation of each
+ *  evaluation type, Jacobian fills, preconditioner setup, solve, output) are
+ *  scoped by a MemoryPhase. The preconditioner setup is the initialization of
+ *  the Stratimikos solver (see MemoryPhaseLOWSFactory), or, with a matrix-free
+ *  Jacobian, the one of the lagged preconditioner in the ModelEvaluator.
+ *  At the end of each phase, this rank records
+ *
+ *    rss:             current resident set size
+ *    rss_peak:        peak resident set size so far (getrusage)
+ *    rss_peak_growth: growth of the peak during the phase (max over calls)
+ *    kokkos:          bytes in Kokkos allocations
+ *    kokkos_peak:     peak bytes in Kokkos allocations during the phase
+ *
+ *  all in MB. Kokkos allocations are tracked through the Kokkos Tools
+ *  callbacks, so only if no profiling library is loaded, and only the
+ *  allocations made after enableMemoryPhases. Phases can be nested, and
+ *  repeated: values are those of the last call, except for the peaks.
+ *  printMemoryPhases reports min, median, and max over ranks, like
+ *  printMemoryAnalysis.
+ */
+void enableMemoryPhases(const bool enable);
+
+/*! \brief Track Kokkos allocations through the Kokkos Tools callbacks.
+ *
+ *  Called by enableMemoryPhases, and by Main_Solve for the per-evaluator
+ *  allocation counts (see PHAL_EvaluatorMonitor.hpp). Returns false if the
+ *  allocations cannot be tracked: Kokkos older than 3.2, or a profiling
+ *  library is loaded (its callbacks are not overridden).
+ */
+bool trackKokkosAllocations();
+
+//! Number of Kokkos allocations since the tracking started (0 if not tracked)
+long long getKokkosAllocationCount();
+
+class MemoryPhase {
+public:
+  explicit MemoryPhase(const std::string& name);
+  ~MemoryPhase() { stop(); }
+
+  //! End the phase before the end of the scope
+  void stop();
+
+private:
+  std::string name_;
+  bool        active_;
+  double      rss_peak_start_;
+  long long   kokkos_peak_outer_;
+};
+
+void printMemoryPhases(
+  std::ostream& os, const Teuchos::RCP< const Teuchos::Comm<int> >& comm);
 }
 
 #endif // ALBANY_MEMORY_HPP
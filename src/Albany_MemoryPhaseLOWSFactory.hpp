@@ -0,0 +1,151 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MEMORY_PHASE_LOWS_FACTORY_HPP
+#define ALBANY_MEMORY_PHASE_LOWS_FACTORY_HPP
+
+#include "Albany_Memory.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+
+#include <string>
+
+namespace Albany {
+
+  //! Decorator of a Thyra_LOWS_Factory, scoping its initialization in a MemoryPhase
+  /*!
+   * The linear solver factory built from the Stratimikos list sets up the
+   * preconditioner (e.g., Ifpack2 or MueLu) when the solver initializes the
+   * LOWS with a new W. This happens inside NOX, so the ModelEvaluator cannot
+   * scope it: this class forwards all calls to the wrapped factory, and runs
+   * the initialize methods inside a MemoryPhase with the given name.
+   * Solves are not part of the phase.
+   */
+  class MemoryPhaseLOWSFactory : public Thyra_LOWS_Factory {
+  public:
+
+    MemoryPhaseLOWSFactory(const Teuchos::RCP<Thyra_LOWS_Factory>& factory_,
+                           const std::string& phaseName_) :
+      factory(factory_),
+      phaseName(phaseName_) {}
+
+    //! Destructor
+    virtual ~MemoryPhaseLOWSFactory() {}
+
+    //! The wrapped factory
+    Teuchos::RCP<Thyra_LOWS_Factory> getFactory () const { return factory; }
+
+    //! @name Overrides of Thyra::LinearOpWithSolveFactoryBase methods
+    //@{
+
+    bool isCompatible(const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const {
+      return factory->isCompatible(fwdOpSrc);
+    }
+
+    Teuchos::RCP<Thyra_LOWS> createOp() const {
+      return factory->createOp();
+    }
+
+    void initializeOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                      Thyra_LOWS* Op,
+                      const Thyra::ESupportSolveUse supportSolveUse) const {
+      MemoryPhase memoryPhase(phaseName);
+      factory->initializeOp(fwdOpSrc, Op, supportSolveUse);
+    }
+
+    void initializeAndReuseOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                              Thyra_LOWS* Op) const {
+      MemoryPhase memoryPhase(phaseName);
+      factory->initializeAndReuseOp(fwdOpSrc, Op);
+    }
+
+    void uninitializeOp(Thyra_LOWS* Op,
+                        Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+                        Teuchos::RCP<const Thyra_Preconditioner>* prec,
+                        Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* approxFwdOpSrc,
+                        Thyra::ESupportSolveUse* supportSolveUse) const {
+      factory->uninitializeOp(Op, fwdOpSrc, prec, approxFwdOpSrc, supportSolveUse);
+    }
+
+    bool supportsPreconditionerInputType(const Thyra::EPreconditionerInputType precOpType) const {
+      return factory->supportsPreconditionerInputType(precOpType);
+    }
+
+    void initializePreconditionedOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                                    const Teuchos::RCP<const Thyra_Preconditioner>& prec,
+                                    Thyra_LOWS* Op,
+                                    const Thyra::ESupportSolveUse supportSolveUse) const {
+      MemoryPhase memoryPhase(phaseName);
+      factory->initializePreconditionedOp(fwdOpSrc, prec, Op, supportSolveUse);
+    }
+
+    void initializeApproxPreconditionedOp(const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                                          const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& approxFwdOpSrc,
+                                          Thyra_LOWS* Op,
+                                          const Thyra::ESupportSolveUse supportSolveUse) const {
+      MemoryPhase memoryPhase(phaseName);
+      factory->initializeApproxPreconditionedOp(fwdOpSrc, approxFwdOpSrc, Op, supportSolveUse);
+    }
+
+    bool acceptsPreconditionerFactory() const {
+      return factory->acceptsPreconditionerFactory();
+    }
+
+    void setPreconditionerFactory(const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& precFactory,
+                                  const std::string& precFactoryName) {
+      factory->setPreconditionerFactory(precFactory, precFactoryName);
+    }
+
+    Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> getPreconditionerFactory() const {
+      return factory->getPreconditionerFactory();
+    }
+
+    void unsetPreconditionerFactory(Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>* precFactory,
+                                    std::string* precFactoryName) {
+      factory->unsetPreconditionerFactory(precFactory, precFactoryName);
+    }
+
+    //@}
+
+    //! @name Overrides of Teuchos::ParameterListAcceptor methods
+    //@{
+
+    void setParameterList(const Teuchos::RCP<Teuchos::ParameterList>& paramList) {
+      factory->setParameterList(paramList);
+    }
+
+    Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList() {
+      return factory->getNonconstParameterList();
+    }
+
+    Teuchos::RCP<Teuchos::ParameterList> unsetParameterList() {
+      return factory->unsetParameterList();
+    }
+
+    Teuchos::RCP<const Teuchos::ParameterList> getParameterList() const {
+      return factory->getParameterList();
+    }
+
+    Teuchos::RCP<const Teuchos::ParameterList> getValidParameters() const {
+      return factory->getValidParameters();
+    }
+
+    //@}
+
+    std::string description() const {
+      return "Albany::MemoryPhaseLOWSFactory{" + factory->description() + "}";
+    }
+
+  private:
+
+    Teuchos::RCP<Thyra_LOWS_Factory> factory;
+    std::string                      phaseName;
+  };
+
+} // namespace Albany
+
+#endif // ALBANY_MEMORY_PHASE_LOWS_FACTORY_HPP
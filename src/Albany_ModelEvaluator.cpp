@@ -8,10 +8,14 @@
 
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_DistributedParameterDerivativeOp.hpp"
+#include "Albany_MatrixFreeJacobianOp.hpp"
+#include "Albany_Memory.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Albany_ObserverImpl.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "Thyra_DefaultLinearOpSource.hpp"
+#include "Thyra_VectorStdOps.hpp"
 
 #include "Albany_Application.hpp"
 
@@ -62,8 +66,51 @@ ModelEvaluator (const Teuchos::RCP<Albany::Application>&    app_,
     use_tempus = true; 
   }
 
+  // Jacobian operator: assembled CrsMatrix (default), or matrix-free via Tangent fills
+  const std::string jac_op_type = problemParams.get<std::string>("Jacobian Operator", "Assembled");
+  TEUCHOS_TEST_FOR_EXCEPTION (jac_op_type!="Assembled" && jac_op_type!="Matrix-Free",
+      Teuchos::Exceptions::InvalidParameter,
+      "Error! Invalid value '" << jac_op_type << "' for 'Jacobian Operator'. Valid choices: 'Assembled', 'Matrix-Free'.\n");
+  matrix_free_jacobian = (jac_op_type=="Matrix-Free");
+  if (matrix_free_jacobian) {
+    TEUCHOS_TEST_FOR_EXCEPTION (supplies_prec, std::logic_error,
+        "Error! 'Jacobian Operator' = 'Matrix-Free' cannot be combined with a physics-based preconditioner.\n");
+
+    // Sensitivity solves build the solver (e.g., Ifpack2) directly on W_op, which
+    // has no matrix in matrix-free mode. Note: the Application already moved the
+    // flag from the Problem list to the Piro one.
+    bool compute_sens = false;
+    if (appParams->isSublist("Piro") && appParams->sublist("Piro").isSublist("Analysis") &&
+        appParams->sublist("Piro").sublist("Analysis").isSublist("Solve")) {
+      const auto& solveParams = appParams->sublist("Piro").sublist("Analysis").sublist("Solve");
+      compute_sens = solveParams.isType<bool>("Compute Sensitivities") &&
+                     solveParams.get<bool>("Compute Sensitivities");
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION (compute_sens, std::logic_error,
+        "Error! 'Jacobian Operator' = 'Matrix-Free' cannot be combined with 'Compute Sensitivities'.\n");
+
+    prec_refresh_interval = problemParams.get<int>("Preconditioner Jacobian Refresh Interval", 1);
+    *out << "Using matrix-free Jacobian operator (Tangent fills); preconditioner Jacobian is ";
+    if (prec_refresh_interval>0) {
+      *out << "reassembled every " << prec_refresh_interval << " preconditioner evaluation(s).\n";
+    } else {
+      *out << "assembled only once.\n";
+    }
+  }
+
   getParameterSizes(parameterParams, total_num_param_vecs, num_param_vecs, num_dist_param_vecs);
 
+  // Linear transient problems: assemble mass and stiffness once, and form W and f from them
+  cache_linear_operators = problemParams.get<bool>("Cache Linear Transient Operators", false);
+  if (cache_linear_operators) {
+    TEUCHOS_TEST_FOR_EXCEPTION (matrix_free_jacobian, std::logic_error,
+        "Error! 'Cache Linear Transient Operators' cannot be combined with 'Jacobian Operator' = 'Matrix-Free'.\n");
+    TEUCHOS_TEST_FOR_EXCEPTION (num_dist_param_vecs>0, std::logic_error,
+        "Error! 'Cache Linear Transient Operators' does not support distributed parameters.\n");
+    linear_operators_check_tol = problemParams.get<double>("Linear Transient Operators Check Tolerance", 1e-10);
+    *out << "Caching mass and stiffness operators of the (linear) transient problem.\n";
+  }
+
   *out << "Total number of parameters  = " << total_num_param_vecs << std::endl;
   *out << "Number of non-distributed parameters  = " << num_param_vecs << std::endl;
 
@@ -424,12 +471,21 @@ ModelEvaluator::get_p_names(int l) const
 Teuchos::RCP<Thyra_LinearOp>
 ModelEvaluator::create_W_op() const
 {
+  if (matrix_free_jacobian) {
+    return Teuchos::rcp( new MatrixFreeJacobianOp(app) );
+  }
   return app->getDisc()->createJacobianOp();
 }
 
 Teuchos::RCP<Thyra_Preconditioner>
 ModelEvaluator::create_W_prec() const
 {
+  if (matrix_free_jacobian) {
+    TEUCHOS_TEST_FOR_EXCEPTION (prec_factory.is_null(), std::logic_error,
+        "Error! Matrix-free Jacobian requested, but no preconditioner factory was set.\n");
+    return prec_factory->createPrec();
+  }
+
   Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec  = Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
   Teuchos::RCP<Thyra_LinearOp>                   precOp  = app->getPreconditioner();
 
@@ -533,7 +589,7 @@ Thyra_OutArgs ModelEvaluator::createOutArgsImpl() const
 
   result.setSupports(Thyra_ModelEvaluator::OUT_ARG_f, true);
 
-  if (supplies_prec)
+  if (supplies_prec || matrix_free_jacobian)
     result.setSupports(Thyra_ModelEvaluator::OUT_ARG_W_prec, true);
 
   result.setSupports(Thyra_ModelEvaluator::OUT_ARG_W_op, true);
@@ -658,6 +714,132 @@ Thyra_OutArgs ModelEvaluator::createOutArgsImpl() const
   return static_cast<Thyra_OutArgs>(result);
 }
 
+bool ModelEvaluator::
+cachedLinearOperatorsAreCurrent () const
+{
+  if (cached_mass_op.is_null()) {
+    return false;
+  }
+  for (int l = 0; l < num_param_vecs; ++l) {
+    for (unsigned int k = 0; k < sacado_param_vec[l].size(); ++k) {
+      if (sacado_param_vec[l][k].baseValue != cached_param_values[l][k]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void ModelEvaluator::
+buildCachedLinearOperators (const ST curr_time,
+                            const Teuchos::RCP<const Thyra_Vector>& x,
+                            const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                            const double dt) const
+{
+  if (cached_mass_op.is_null()) {
+    cached_mass_op      = app->getDisc()->createJacobianOp();
+    cached_stiffness_op = app->getDisc()->createJacobianOp();
+    cached_forcing      = Thyra::createMember(cached_mass_op->range());
+  }
+
+  // M = df/dx_dot
+  app->computeGlobalJacobian(1.0, 0.0, 0.0, curr_time,
+                             x, x_dot, Teuchos::null,
+                             sacado_param_vec,
+                             Teuchos::null, cached_mass_op, dt);
+
+  // K = df/dx, and b = f(x,x_dot) - K*x - M*x_dot
+  app->computeGlobalJacobian(0.0, 1.0, 0.0, curr_time,
+                             x, x_dot, Teuchos::null,
+                             sacado_param_vec,
+                             cached_forcing, cached_stiffness_op, dt);
+  cached_stiffness_op->apply(Thyra::NOTRANS, *x, cached_forcing.ptr(), -1.0, 1.0);
+  cached_mass_op->apply(Thyra::NOTRANS, *x_dot, cached_forcing.ptr(), -1.0, 1.0);
+  cached_forcing_time = curr_time;
+
+  cached_param_values.resize(num_param_vecs);
+  for (int l = 0; l < num_param_vecs; ++l) {
+    cached_param_values[l].resize(sacado_param_vec[l].size());
+    for (unsigned int k = 0; k < sacado_param_vec[l].size(); ++k) {
+      cached_param_values[l][k] = sacado_param_vec[l][k].baseValue;
+    }
+  }
+}
+
+void ModelEvaluator::
+updateCachedForcing (const ST curr_time,
+                     const Teuchos::RCP<const Thyra_Vector>& x,
+                     const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                     const double dt) const
+{
+  // M and K do not depend on time, but source terms and Dirichlet data may
+  app->computeGlobalResidual(curr_time, x, x_dot, Teuchos::null,
+                             sacado_param_vec, cached_forcing, dt);
+  cached_stiffness_op->apply(Thyra::NOTRANS, *x, cached_forcing.ptr(), -1.0, 1.0);
+  cached_mass_op->apply(Thyra::NOTRANS, *x_dot, cached_forcing.ptr(), -1.0, 1.0);
+  cached_forcing_time = curr_time;
+}
+
+bool ModelEvaluator::
+checkCachedLinearOperators (const ST curr_time,
+                            const Teuchos::RCP<const Thyra_Vector>& x,
+                            const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                            const double dt) const
+{
+  // At the point where they were built, K*x+M*x_dot+b=f holds by construction,
+  // so move both x and x_dot away from it.
+  auto x_p     = Thyra::createMember(x->space());
+  auto x_dot_p = Thyra::createMember(x_dot->space());
+  Thyra::V_StV(x_p.ptr(), 1.1, *x);
+  Thyra::add_scalar(0.1, x_p.ptr());
+  Thyra::V_StV(x_dot_p.ptr(), 1.1, *x_dot);
+  Thyra::add_scalar(0.1, x_dot_p.ptr());
+
+  auto f_full = Thyra::createMember(cached_forcing->space());
+  app->computeGlobalResidual(curr_time, x_p, x_dot_p, Teuchos::null,
+                             sacado_param_vec, f_full, dt);
+
+  auto f_cached = Thyra::createMember(cached_forcing->space());
+  f_cached->assign(*cached_forcing);
+  cached_stiffness_op->apply(Thyra::NOTRANS, *x_p, f_cached.ptr(), 1.0, 1.0);
+  cached_mass_op->apply(Thyra::NOTRANS, *x_dot_p, f_cached.ptr(), 1.0, 1.0);
+
+  const ST f_norm = std::max(f_full->norm_2(),1.0);
+  Thyra::Vp_StV(f_full.ptr(), -1.0, *f_cached);
+  const ST diff = f_full->norm_2();
+  if (diff > linear_operators_check_tol*f_norm) {
+    *out << "Warning! The residual is not affine in x and x_dot (relative difference: "
+         << diff/f_norm << "). Disabling 'Cache Linear Transient Operators'.\n";
+    return false;
+  }
+  return true;
+}
+
+void ModelEvaluator::
+combineCachedLinearOperators (const ST alpha, const ST beta,
+                              const Teuchos::RCP<Thyra_LinearOp>& W) const
+{
+  // All operators come from the discretization's Jacobian graph, so we can
+  // combine them entry by entry, without any field manager evaluation.
+  Teuchos::RCP<const Thyra_LinearOp> M = cached_mass_op;
+  Teuchos::RCP<const Thyra_LinearOp> K = cached_stiffness_op;
+  Teuchos::RCP<Thyra_LinearOp> W_nonconst = W;
+
+  resumeFill(W_nonconst);
+  const auto M_vals = getDeviceData(M).values;
+  const auto K_vals = getDeviceData(K).values;
+  const auto W_vals = getNonconstDeviceData(W_nonconst).values;
+  TEUCHOS_TEST_FOR_EXCEPTION (W_vals.extent(0)!=M_vals.extent(0) || W_vals.extent(0)!=K_vals.extent(0),
+      std::logic_error, "Error! W and the cached mass/stiffness operators do not share the same graph.\n");
+
+  Kokkos::parallel_for("ModelEvaluator::combineCachedLinearOperators",
+                       Kokkos::RangePolicy<PHX::Device::execution_space>(0,W_vals.extent(0)),
+                       KOKKOS_LAMBDA(const int i) {
+    W_vals(i) = alpha*M_vals(i) + beta*K_vals(i);
+  });
+  fillComplete(W_nonconst);
+}
+
 void ModelEvaluator::
 evalModelImpl(const Thyra_InArgs&  inArgs,
               const Thyra_OutArgs& outArgs) const
@@ -697,6 +879,7 @@ evalModelImpl(const Thyra_InArgs&  inArgs,
       if((iter >= 0) && (iter != iteration) && (iteration%write_interval == 0))
       {
         Teuchos::TimeMonitor timer(*Teuchos::TimeMonitor::getNewTimer("Albany: Output to File"));
+        MemoryPhase memoryPhase("Output");
         const Teuchos::RCP<const Thyra_Vector> x = inArgs.get_x();
         observer.observeSolution(iter, *x, Teuchos::null, Teuchos::null, Teuchos::null);
         iteration = iter;
@@ -783,6 +966,8 @@ evalModelImpl(const Thyra_InArgs&  inArgs,
   //
   auto f_out    = outArgs.get_f();
   auto W_op_out = outArgs.get_W_op();
+  auto W_prec_out = outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_W_prec) ?
+                    outArgs.get_W_prec() : Teuchos::null;
 
   //
   // Compute the functions
@@ -828,9 +1013,79 @@ evalModelImpl(const Thyra_InArgs&  inArgs,
 #endif
 
   bool f_already_computed = false;
+  bool W_already_computed = false;
+
+  // Cached mass/stiffness operators: W = alpha*M + beta*K, f = K*x + M*x_dot + b.
+  // Second order problems, transposed Jacobians and adjoints go through the usual fills.
+  const bool use_cached_operators = cache_linear_operators && Teuchos::nonnull(x_dot) &&
+                                    x_dotdot.is_null() && !transposeJacobian && !app->is_adjoint;
+  if (use_cached_operators) {
+    if (!cachedLinearOperatorsAreCurrent()) {
+      buildCachedLinearOperators(curr_time, x, x_dot, dt);
+      if (linear_operators_check_pending && linear_operators_check_tol>=0) {
+        linear_operators_check_pending = false;
+        if (!checkCachedLinearOperators(curr_time, x, x_dot, dt)) {
+          cache_linear_operators = false;
+          cached_mass_op = cached_stiffness_op = Teuchos::null;
+          cached_forcing = Teuchos::null;
+        }
+      }
+    } else if (curr_time != cached_forcing_time) {
+      updateCachedForcing(curr_time, x, x_dot, dt);
+    }
+
+    if (cache_linear_operators && Teuchos::nonnull(f_out)) {
+      f_out->assign(*cached_forcing);
+      cached_stiffness_op->apply(Thyra::NOTRANS, *x, f_out.ptr(), 1.0, 1.0);
+      cached_mass_op->apply(Thyra::NOTRANS, *x_dot, f_out.ptr(), 1.0, 1.0);
+      f_already_computed = true;
+    }
+
+    if (cache_linear_operators && Teuchos::nonnull(W_op_out)) {
+      combineCachedLinearOperators(alpha, beta, W_op_out);
+      W_already_computed = true;
+    }
+  }
 
   // W matrix
-  if (Teuchos::nonnull(W_op_out)) {
+  if (W_already_computed) {
+    // Nothing to do
+  } else if (matrix_free_jacobian) {
+    // The operator only needs to know where to linearize; the action of W
+    // is computed by a Tangent fill inside each apply.
+    if (Teuchos::nonnull(W_op_out)) {
+      auto W_mf = Teuchos::rcp_dynamic_cast<MatrixFreeJacobianOp>(W_op_out,true);
+      W_mf->set(alpha, beta, omega, curr_time,
+                x, x_dot, x_dotdot,
+                Teuchos::rcpFromRef(sacado_param_vec));
+    }
+
+    // The preconditioner is built from an assembled Jacobian, which is only
+    // refreshed every prec_refresh_interval evaluations (lagged Jacobian)
+    if (Teuchos::nonnull(W_prec_out)) {
+      const bool refresh = Extra_W_op.is_null() ||
+                           (prec_refresh_interval>0 && num_prec_evals%prec_refresh_interval==0);
+      if (refresh) {
+        if (Extra_W_op.is_null()) {
+          Extra_W_op = app->getDisc()->createJacobianOp();
+        }
+        app->computeGlobalJacobian(
+            alpha, beta, omega, curr_time,
+            x, x_dot, x_dotdot,
+            sacado_param_vec,
+            f_out, Extra_W_op, dt);
+        f_already_computed = true;
+      }
+      // The solver may hand us a new (uninitialized) preconditioner object,
+      // which must be set up even if the lagged Jacobian is not refreshed
+      if (refresh || W_prec_out!=last_initialized_prec) {
+        MemoryPhase memoryPhase("Preconditioner Setup");
+        prec_factory->initializePrec(Thyra::defaultLinearOpSource<ST>(Extra_W_op), W_prec_out.get());
+        last_initialized_prec = W_prec_out;
+      }
+      ++num_prec_evals;
+    }
+  } else if (Teuchos::nonnull(W_op_out)) {
     app->computeGlobalJacobian(
         alpha, beta, omega, curr_time,
         x, x_dot, x_dotdot,
@@ -12,6 +12,7 @@
 #include "Albany_ThyraTypes.hpp"
 
 #include "Piro_TransientDecorator.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
 
 namespace Albany {
 
@@ -76,6 +77,14 @@ public:
   //@}
 
   Teuchos::RCP<Application> getAlbanyApp () const { return app; }
+
+  //! Whether W_op is the matrix-free (Tangent-based) Jacobian operator
+  bool usesMatrixFreeJacobian () const { return matrix_free_jacobian; }
+
+  //! Set the factory used to build W_prec from the assembled (lagged) Jacobian
+  void setPreconditionerFactory (const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& pf) {
+    prec_factory = pf;
+  }
  protected:
   /** \name Overridden from Thyra::ModelEvaluatorDefaultBase<ST> . */
   //@{
@@ -124,6 +133,71 @@ public:
   //! Boolean marking whether Tempus is used 
   bool use_tempus{false}; 
 
+  //! Whether W_op applies the Jacobian via Tangent fills rather than assembling it
+  bool matrix_free_jacobian{false};
+
+  //! Reassemble the preconditioner Jacobian every this many W_prec evaluations (<=0: only once)
+  int prec_refresh_interval{1};
+
+  //! Number of W_prec evaluations performed so far in matrix-free mode
+  mutable int num_prec_evals{0};
+
+  //! Factory for the preconditioner of the matrix-free operator
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> prec_factory;
+
+  //! Last preconditioner object initialized by the factory (the solver may pass a new one)
+  mutable Teuchos::RCP<Thyra::PreconditionerBase<ST>> last_initialized_prec;
+
+  //! @name Cached operators for linear transient problems, f = K*x + M*x_dot + b
+  //@{
+
+  //! Whether W and f are formed from cached mass/stiffness operators (may be turned off by the check)
+  mutable bool cache_linear_operators{false};
+
+  //! Relative tolerance of the affinity check performed after the first assembly (<0: no check)
+  double linear_operators_check_tol{1e-10};
+
+  //! Whether the affinity check still has to be performed
+  mutable bool linear_operators_check_pending{true};
+
+  mutable Teuchos::RCP<Thyra_LinearOp> cached_mass_op;
+  mutable Teuchos::RCP<Thyra_LinearOp> cached_stiffness_op;
+  mutable Teuchos::RCP<Thyra_Vector>   cached_forcing;
+
+  //! Time at which cached_forcing was computed (forcing and Dirichlet data may depend on time)
+  mutable ST cached_forcing_time{0};
+
+  //! Values of the scalar parameters used to build the cached operators
+  mutable Teuchos::Array<Teuchos::Array<ST>> cached_param_values;
+
+  //! Whether the cached operators exist and were built with the current parameter values
+  bool cachedLinearOperatorsAreCurrent () const;
+
+  //! Assemble M, K and b (two Jacobian fills)
+  void buildCachedLinearOperators (const ST curr_time,
+                                   const Teuchos::RCP<const Thyra_Vector>& x,
+                                   const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                                   const double dt) const;
+
+  //! Recompute b = f(x,x_dot,t) - K*x - M*x_dot at a new time (one residual fill)
+  void updateCachedForcing (const ST curr_time,
+                            const Teuchos::RCP<const Thyra_Vector>& x,
+                            const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                            const double dt) const;
+
+  //! Compare K*x+M*x_dot+b with the residual at a point different from the
+  //! one the operators were built at. Returns false if the residual is not affine.
+  bool checkCachedLinearOperators (const ST curr_time,
+                                   const Teuchos::RCP<const Thyra_Vector>& x,
+                                   const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                                   const double dt) const;
+
+  //! W = alpha*M + beta*K, computed on the (shared) cached sparsity pattern
+  void combineCachedLinearOperators (const ST alpha, const ST beta,
+                                     const Teuchos::RCP<Thyra_LinearOp>& W) const;
+
+  //@}
+
   //@}
 
   //! Total number of parameter vectors (num_param_vecs+num_dist_param_vecs)
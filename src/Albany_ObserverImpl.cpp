@@ -35,11 +35,13 @@ observeSolution(double stamp,
   //! update distributed parameters in the mesh
   auto distParamLib = app_->getDistributedParameterLibrary();
   auto disc = app_->getDiscretization();
-  distParamLib->scatter();
-  for(auto it : *distParamLib) {
-    disc->setField(*it.second->overlapped_vector(),
-                    it.second->name(),
-                   /*overlapped*/ true);
+  if (disc->isSolutionOutputStep()) {
+    distParamLib->scatter();
+    for(auto it : *distParamLib) {
+      disc->setField(*it.second->overlapped_vector(),
+                      it.second->name(),
+                     /*overlapped*/ true);
+    }
   }
 
   StatelessObserverImpl::observeSolution (stamp,
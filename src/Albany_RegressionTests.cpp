@@ -11,10 +11,17 @@
 #include "Albany_Utils.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
+#include "string.hpp"
 
 #include "Thyra_DetachedVectorView.hpp"
 
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include <fstream>
+#include <sstream>
 
 namespace Albany
 {
@@ -190,6 +197,142 @@ int RegressionTests::checkAnalysisTestResults(
   return failures;
 }
 
+int RegressionTests::checkPerformanceTestResults(
+    const Teuchos::RCP<Teuchos::StackedTimer>&    stackedTimer,
+    const Teuchos::RCP<const Teuchos_Comm>&       comm) const
+{
+  if (!appParams->isSublist("Performance Tests")) {
+    return 0;
+  }
+
+  Teuchos::ParameterList& perfParams = appParams->sublist("Performance Tests");
+  perfParams.validateParametersAndSetDefaults(
+      *getValidPerformanceTestsParameters(), 0);
+
+  const double relTol   = perfParams.get<double>("Relative Tolerance");
+  const double absTol   = perfParams.get<double>("Absolute Tolerance");
+  const int    numTests = perfParams.get<int>("Number of Timers");
+  const double memCeil  = perfParams.get<double>("Memory Ceiling (MB)");
+  const std::string jsonFile = perfParams.get<std::string>("JSON Output File");
+
+  int failures    = 0;
+  int comparisons = 0;
+
+  std::stringstream json;
+  json << "{\n  \"timers\": [";
+
+  for (int i = 0; i < numTests; ++i) {
+    const std::string sublist_name = strint("Timer", i);
+    ALBANY_ASSERT(
+        perfParams.isSublist(sublist_name),
+        "\"Number of Timers\" is " << numTests << ", but sublist \""
+                                   << sublist_name << "\" is missing!");
+    Teuchos::ParameterList& timerParams = perfParams.sublist(sublist_name);
+    // Note: no defaults, since tolerances fall back on the values in perfParams
+    timerParams.validateParameters(*getValidPerformanceTimerParameters(), 0);
+
+    const std::string name    = timerParams.get<std::string>("Name");
+    const double      refTime = timerParams.get<double>("Reference Time");
+    const double      rTol    = timerParams.get<double>("Relative Tolerance", relTol);
+    const double      aTol    = timerParams.get<double>("Absolute Tolerance", absTol);
+
+    // Full StackedTimer paths (containing '@') are looked up in the stacked
+    // timer. Bare names are looked up among the TimeMonitor counters, which
+    // feed the stacked timer, and accumulate over all call sites.
+    double localTime  = 0.0;
+    int    localCount = 0;
+    bool   found      = false;
+    if (name.find('@') != std::string::npos) {
+      try {
+        const auto info = stackedTimer->findTimer(name);
+        localTime  = info.time;
+        localCount = info.count;
+        found = true;
+      } catch (const std::runtime_error&) {}
+    } else {
+      const auto timer = Teuchos::TimeMonitor::lookupCounter(name);
+      if (Teuchos::nonnull(timer)) {
+        localTime  = timer->totalElapsedTime();
+        localCount = timer->numCalls();
+        found = true;
+      }
+    }
+
+    int globalFound = 0;
+    int localFound  = found ? 1 : 0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 1, &localFound, &globalFound);
+    double time = 0.0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 1, &localTime, &time);
+    int count = 0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 1, &localCount, &count);
+
+    // Only slowdowns count as failures
+    const double maxTime = refTime * (1.0 + rTol) + aTol;
+    const bool   passed  = globalFound==1 && time <= maxTime;
+    if (globalFound==0) {
+      *out << "Performance Test \"" << name << "\": timer not found.\n";
+    } else if (!passed) {
+      *out << "Performance Test \"" << name << "\": " << time << " s > "
+           << maxTime << " s (reference " << refTime << " s, rel " << rTol
+           << " abs " << aTol << ")\n";
+    } else if (time < refTime * (1.0 - rTol) - aTol) {
+      *out << "Performance Test \"" << name << "\": " << time
+           << " s is faster than reference " << refTime
+           << " s; consider updating the reference time.\n";
+    }
+    failures += passed ? 0 : 1;
+    comparisons++;
+
+    json << (i > 0 ? "," : "") << "\n    {"
+         << "\"name\": \"" << util::json_escape(name) << "\", "
+         << "\"found\": " << (globalFound==1 ? "true" : "false") << ", "
+         << "\"time\": " << time << ", "
+         << "\"count\": " << count << ", "
+         << "\"reference\": " << refTime << ", "
+         << "\"relative tolerance\": " << rTol << ", "
+         << "\"absolute tolerance\": " << aTol << ", "
+         << "\"passed\": " << (passed ? "true" : "false") << "}";
+  }
+  json << (numTests > 0 ? "\n  ],\n" : "],\n");
+
+  // Peak memory, if a ceiling was requested
+  if (memCeil > 0.0) {
+    const double localMem = getPeakMemoryUsage();
+    double mem = 0.0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 1, &localMem, &mem);
+    ALBANY_ASSERT(
+        mem >= 0.0,
+        "\"Memory Ceiling (MB)\" requires Albany to be configured with ENABLE_GETRUSAGE=ON.");
+    const bool passed = mem <= memCeil;
+    if (!passed) {
+      *out << "Performance Test \"Memory\": peak RSS " << mem << " MB > "
+           << memCeil << " MB\n";
+    }
+    failures += passed ? 0 : 1;
+    comparisons++;
+
+    json << "  \"memory\": {"
+         << "\"peak rss (MB)\": " << mem << ", "
+         << "\"ceiling (MB)\": " << memCeil << ", "
+         << "\"passed\": " << (passed ? "true" : "false") << "},\n";
+  }
+
+  json << "  \"number of failures\": " << failures << ",\n"
+       << "  \"number of comparisons\": " << comparisons << "\n}\n";
+
+  if (jsonFile != "" && comm->getRank() == 0) {
+    std::ofstream ofs(jsonFile.c_str());
+    ofs << json.str();
+  }
+
+  perfParams.set("Number of Failures", failures);
+  perfParams.set("Number of Comparisons Attempted", comparisons);
+  *out << "\nCheckPerformanceTestResults: Number of Comparisons Attempted = "
+       << comparisons << ", Number of Failures = " << failures << std::endl;
+
+  return failures;
+}
+
 Teuchos::ParameterList*
 RegressionTests::getTestParameters(int response_index) const
 {
@@ -336,4 +479,75 @@ RegressionTests::getValidRegressionResultsParameters() const
   return validPL;
 }
 
+Teuchos::RCP<const Teuchos::ParameterList>
+RegressionTests::getValidPerformanceTestsParameters() const
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL = rcp(new Teuchos::ParameterList("ValidPerformanceTestsParams"));
+
+  validPL->set<double>(
+      "Relative Tolerance",
+      0.1,
+      "Default relative slowdown allowed w.r.t. the reference times");
+  validPL->set<double>(
+      "Absolute Tolerance",
+      0.0,
+      "Default absolute slowdown (in seconds) allowed w.r.t. the reference times");
+  validPL->set<int>(
+      "Number of Timers",
+      0,
+      "Number of \"Timer i\" sublists to check");
+  validPL->set<double>(
+      "Memory Ceiling (MB)",
+      0.0,
+      "Maximum peak resident set size allowed on any rank (0 disables the check)");
+  validPL->set<std::string>(
+      "JSON Output File",
+      "performance_tests.json",
+      "File where the results are written (empty string disables output)");
+
+  const int maxTimers = 20;
+  for (int i = 0; i < maxTimers; i++) {
+    validPL->sublist(strint("Timer", i), false, "Performance Timer sublist");
+  }
+
+  // These two are typically not set on input, just output.
+  validPL->set<int>(
+      "Number of Failures",
+      0,
+      "Output information from performance tests reporting number of failed "
+      "tests");
+  validPL->set<int>(
+      "Number of Comparisons Attempted",
+      0,
+      "Output information from performance tests reporting number of "
+      "comparisons attempted");
+
+  return validPL;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+RegressionTests::getValidPerformanceTimerParameters() const
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL = rcp(new Teuchos::ParameterList("ValidPerformanceTimerParams"));
+
+  validPL->set<std::string>(
+      "Name",
+      "",
+      "StackedTimer path (with '@' separators) or TimeMonitor name of the timer");
+  validPL->set<double>(
+      "Reference Time",
+      0.0,
+      "Reference time (in seconds) for this timer");
+  validPL->set<double>(
+      "Relative Tolerance",
+      0.1,
+      "Relative slowdown allowed w.r.t. the reference time");
+  validPL->set<double>(
+      "Absolute Tolerance",
+      0.0,
+      "Absolute slowdown (in seconds) allowed w.r.t. the reference time");
+
+  return validPL;
+}
+
 } // namespace Albany
@@ -8,10 +8,12 @@
 #define ALBANY_REGRESSION_TESTS_HPP
 
 #include "Albany_ThyraTypes.hpp"
+#include "Albany_CommTypes.hpp"
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_FancyOStream.hpp"
+#include "Teuchos_StackedTimer.hpp"
 
 //! Albany driver code, problems, discretizations, and responses
 namespace Albany {
@@ -38,10 +40,29 @@ public:
       int                                            response_index,
       const Teuchos::RCP<Thyra_Vector>& tvec) const;
 
+  /** \brief Function that checks timers and memory usage against the
+   *         reference values in the "Performance Tests" sublist.
+   *
+   *  Each "Timer i" sublist names a StackedTimer entry, either by its full
+   *  path (e.g., "Albany Total Time@Albany: Setup Time") or by the bare
+   *  TimeMonitor name (e.g., "Albany Fill: Jacobian"). The max time over
+   *  all ranks is compared against "Reference Time", and fails if it is
+   *  slower than the reference by more than the tolerances. If a
+   *  "Memory Ceiling (MB)" is given, the peak resident set size over all
+   *  ranks is checked as well. Results are written in JSON format by rank 0.
+   */
+  int checkPerformanceTestResults(
+      const Teuchos::RCP<Teuchos::StackedTimer>&    stackedTimer,
+      const Teuchos::RCP<const Teuchos_Comm>&       comm) const;
+
 protected:
   // Private functions to set default parameter values
   Teuchos::RCP<const Teuchos::ParameterList>
   getValidRegressionResultsParameters() const;
+  Teuchos::RCP<const Teuchos::ParameterList>
+  getValidPerformanceTestsParameters() const;
+  Teuchos::RCP<const Teuchos::ParameterList>
+  getValidPerformanceTimerParameters() const;
 
   /** \brief Testing utility that compares two numbers using two tolerances */
   bool scaledCompare (double             x1,
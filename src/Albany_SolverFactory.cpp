@@ -11,6 +11,7 @@
 #include "Albany_Utils.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_MemoryPhaseLOWSFactory.hpp"
 
 #include "Piro_ProviderBase.hpp"
 #include "Piro_NOXSolver.hpp"
@@ -235,9 +236,23 @@ createSolver (const Teuchos::RCP<ModelEvaluator>&     model,
 #endif
     linearSolverBuilder.setParameterList(stratList);
 
-    const Teuchos::RCP<Thyra_LOWS_Factory> lowsFactory =
+    Teuchos::RCP<Thyra_LOWS_Factory> lowsFactory =
         createLinearSolveStrategy(linearSolverBuilder);
 
+    // The preconditioner is set up when NOX initializes the solver with a
+    // new W, so the memory analysis can only scope it from here
+    const bool analyzeMemory = m_appParams->isSublist("Debug Output") &&
+        m_appParams->sublist("Debug Output").get<bool>("Analyze Memory", false);
+    if (analyzeMemory) {
+      lowsFactory = rcp(new MemoryPhaseLOWSFactory(lowsFactory, "Preconditioner Setup"));
+    }
+
+    // A matrix-free W cannot be handed to an algebraic preconditioner, so the
+    // model builds W_prec itself, from an assembled (lagged) Jacobian
+    if (model->usesMatrixFreeJacobian()) {
+      model->setPreconditionerFactory(createPreconditioningStrategy(linearSolverBuilder));
+    }
+
     modelWithSolve = rcp(new Thyra::DefaultModelEvaluatorWithSolveFactory<ST>(model, lowsFactory));
   }
 
@@ -339,6 +354,7 @@ SolverFactory::getValidAppParameters() const
   for (int i = 0; i < maxRegression; i++) {
     validPL->sublist(strint("Regression For Response", i), false, "Regression Results sublist");
   }
+  validPL->sublist("Performance Tests", false, "Performance Regression sublist");
   validPL->sublist("VTK", false, "DEPRECATED  VTK sublist");
   validPL->sublist("Piro", false, "Piro sublist");
   validPL->sublist("Coupled System", false, "Coupled system sublist");
@@ -372,6 +388,9 @@ SolverFactory::getValidDebugParameters() const
   validPL->set<int>("Write Solution to Standard Output", 0, "Residual Number to Dump to Standard Output");
   validPL->set<bool>("Analyze Memory", false, "Flag to Analyze Memory");
   validPL->set<bool>("Report Timers", true, "Whether to report timers at the end of execution");
+  validPL->set<bool>("Report Evaluator Timers", false, "Whether to report per-evaluator timers at the end of execution");
+  validPL->set<std::string>("Evaluator Timers JSON File", "", "File where to write per-evaluator timers in JSON format");
+  validPL->set<bool>("Check Mesh Database Solution", false, "Whether to check that the solution in the mesh database matches the final solution");
   return validPL; 
 }
 
@@ -382,6 +401,8 @@ SolverFactory::getValidScalingParameters() const
   validPL->set<double>("Scale", 0.0, "Value of Scaling to Apply to Jacobian/Residual");
   validPL->set<bool>("Scale BC Dofs", false, "Flag to Scale Jacobian/Residual Rows Corresponding to DBC Dofs");
   validPL->set<std::string>("Type", "Constant", "Scaling Type (Constant, Diagonal, AbsRowSum)");
+  validPL->set<int>("Recompute Interval", 1, "Recompute the Diagonal/AbsRowSum scaling every this many Jacobians (<=0: only when Recompute Tolerance triggers it)");
+  validPL->set<double>("Recompute Tolerance", -1.0, "Recompute the Diagonal/AbsRowSum scaling if a sampled Jacobian row norm changes by more than this, relatively (<=0: no check)");
   return validPL;
 }
 
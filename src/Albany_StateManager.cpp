@@ -8,6 +8,10 @@
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
+#include "Kokkos_Core.hpp"
+
+#include <algorithm>
+
 Albany::StateManager::StateManager()
     : stateVarsAreAllocated(false), stateInfo(Teuchos::rcp(new StateInfoStruct))
 {
@@ -837,6 +841,18 @@ Albany::StateManager::getDiscretization() const
   return disc;
 }
 
+namespace {
+
+// A bulk copy of the storage of a state array
+struct StateCopy
+{
+  double*       to;
+  const double* from;
+  std::size_t   size;
+};
+
+}  // namespace
+
 void
 Albany::StateManager::importStateData(Albany::StateArrays& states_from)
 {
@@ -860,110 +876,25 @@ Albany::StateManager::importStateData(Albany::StateArrays& states_from)
       Teuchos::VerboseObjectBase::getDefaultOStream());
   *out << std::endl;
 
+  // Resolve the arrays once, and collect the copies to do in each workset
+  std::vector<std::vector<StateCopy>> copies(
+      std::max(numElemWorksets, numNodeWorksets));
   for (unsigned int i = 0; i < stateInfo->size(); i++) {
     const std::string stateName = (*stateInfo)[i]->name;
 
+    Albany::StateArrayVec* to   = nullptr;
+    Albany::StateArrayVec* from = nullptr;
     switch ((*stateInfo)[i]->entity) {
       case Albany::StateStruct::WorksetValue:
       case Albany::StateStruct::ElemData:
       case Albany::StateStruct::QuadPoint:
       case Albany::StateStruct::ElemNode:
-
-        // check if state exists in statesToCopyFrom (check first workset only)
-        if (elemStatesToCopyFrom[0].find(stateName) ==
-            elemStatesToCopyFrom[0].end()) {
-          //*out << "StateManager: state " << stateName << " not present, so not
-          // filled" << std::endl;
-          continue;
-        }
-
-        *out << "StateManager: filling state:  " << stateName << std::endl;
-        for (int ws = 0; ws < numElemWorksets; ws++) {
-          Albany::StateStruct::FieldDims dims;
-          esa[ws][stateName].dimensions(dims);
-          int size = dims.size();
-
-          switch (size) {
-            case 1:
-              for (int cell = 0; cell < dims[0]; ++cell)
-                esa[ws][stateName](cell) =
-                    elemStatesToCopyFrom[ws][stateName](cell);
-              break;
-            case 2:
-              for (int cell = 0; cell < dims[0]; ++cell)
-                for (int qp = 0; qp < dims[1]; ++qp)
-                  esa[ws][stateName](cell, qp) =
-                      elemStatesToCopyFrom[ws][stateName](cell, qp);
-              break;
-            case 3:
-              for (int cell = 0; cell < dims[0]; ++cell)
-                for (int qp = 0; qp < dims[1]; ++qp)
-                  for (int i = 0; i < dims[2]; ++i)
-                    esa[ws][stateName](cell, qp, i) =
-                        elemStatesToCopyFrom[ws][stateName](cell, qp, i);
-              break;
-            case 4:
-              for (int cell = 0; cell < dims[0]; ++cell)
-                for (int qp = 0; qp < dims[1]; ++qp)
-                  for (int i = 0; i < dims[2]; ++i)
-                    for (int j = 0; j < dims[3]; ++j)
-                      esa[ws][stateName](cell, qp, i, j) =
-                          elemStatesToCopyFrom[ws][stateName](cell, qp, i, j);
-              break;
-            default:
-              TEUCHOS_TEST_FOR_EXCEPTION(
-                  size < 2 || size > 4,
-                  std::logic_error,
-                  "Something is wrong during zero state variable fill: "
-                      << size);
-          }
-        }
-
+        to   = &esa;
+        from = &elemStatesToCopyFrom;
         break;
-
       case Albany::StateStruct::NodalData:
-
-        // check if state exists in statesToCopyFrom (check first workset only)
-        if (nodeStatesToCopyFrom[0].find(stateName) ==
-            nodeStatesToCopyFrom[0].end()) {
-          //*out << "StateManager: state " << stateName << " not present, so not
-          // filled" << std::endl;
-          continue;
-        }
-
-        *out << "StateManager: filling state:  " << stateName << std::endl;
-        for (int ws = 0; ws < numNodeWorksets; ws++) {
-          Albany::StateStruct::FieldDims dims;
-          nsa[ws][stateName].dimensions(dims);
-          int size = dims.size();
-
-          switch (size) {
-            case 1:  // node scalar
-              for (int node = 0; node < dims[0]; ++node)
-                nsa[ws][stateName](node) =
-                    nodeStatesToCopyFrom[ws][stateName](node);
-              break;
-            case 2:  // node vector
-              for (int node = 0; node < dims[0]; ++node)
-                for (int dim = 0; dim < dims[1]; ++dim)
-                  nsa[ws][stateName](node, dim) =
-                      nodeStatesToCopyFrom[ws][stateName](node, dim);
-              break;
-            case 3:  // node tensor
-              for (int node = 0; node < dims[0]; ++node)
-                for (int dim = 0; dim < dims[1]; ++dim)
-                  for (int i = 0; i < dims[2]; ++i)
-                    nsa[ws][stateName](node, dim, i) =
-                        nodeStatesToCopyFrom[ws][stateName](node, dim, i);
-              break;
-            default:
-              TEUCHOS_TEST_FOR_EXCEPTION(
-                  true,
-                  std::logic_error,
-                  "Something is wrong during node zero state variable fill: "
-                      << size);
-          }
-        }
+        to   = &nsa;
+        from = &nodeStatesToCopyFrom;
         break;
       default:
         TEUCHOS_TEST_FOR_EXCEPTION(
@@ -972,8 +903,53 @@ Albany::StateManager::importStateData(Albany::StateArrays& states_from)
             "Unknown state variable entity encountered "
                 << (*stateInfo)[i]->entity);
     }
+
+    // check if state exists in statesToCopyFrom (check first workset only)
+    if (from->empty() || (*from)[0].find(stateName) == (*from)[0].end()) {
+      //*out << "StateManager: state " << stateName << " not present, so not
+      // filled" << std::endl;
+      continue;
+    }
+
+    *out << "StateManager: filling state:  " << stateName << std::endl;
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        from->size() < to->size(),
+        std::logic_error,
+        "Error! State " << stateName << " is imported from " << from->size()
+                        << " worksets, but " << to->size()
+                        << " are expected.\n");
+    for (std::size_t ws = 0; ws < to->size(); ws++) {
+      auto dst = (*to)[ws].find(stateName);
+      auto src = (*from)[ws].find(stateName);
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          dst == (*to)[ws].end() || src == (*from)[ws].end(),
+          std::logic_error,
+          "Error! State " << stateName << " is missing in workset " << ws
+                          << ".\n");
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          dst->second.size() != src->second.size(),
+          std::logic_error,
+          "Error! State " << stateName << " has " << src->second.size()
+                          << " entries in workset " << ws << ", but "
+                          << dst->second.size() << " were expected.\n");
+      if (dst->second.size() > 0) {
+        copies[ws].push_back({dst->second.contiguous_data(),
+                              src->second.contiguous_data(),
+                              static_cast<std::size_t>(dst->second.size())});
+      }
+    }
   }
 
+  // State arrays are contiguous: copy them in bulk, in parallel over worksets
+  Kokkos::parallel_for(
+      "Albany::StateManager::importStateData",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, copies.size()),
+      [&](const int ws) {
+        for (const auto& c : copies[ws]) {
+          std::copy(c.from, c.from + c.size, c.to);
+        }
+      });
+
   *out << std::endl;
 }
 
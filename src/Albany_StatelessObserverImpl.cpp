@@ -6,6 +6,7 @@
 #include "Albany_StatelessObserverImpl.hpp"
 
 #include "Albany_AbstractDiscretization.hpp"
+#include "Albany_Memory.hpp"
 
 #include "Teuchos_TimeMonitor.hpp"
 
@@ -40,6 +41,16 @@ StatelessObserverImpl::getNonOverlappedVectorSpace () const {
   return app_->getVectorSpace();
 }
 
+bool StatelessObserverImpl::skipSolutionOutput () const {
+  // Nothing is written at this step: skip the imports and the copy into
+  // the mesh database, only advancing the output counters
+  const auto disc = app_->getDiscretization();
+  if (disc->isSolutionOutputStep()) return false;
+
+  disc->skipSolutionOutput();
+  return true;
+}
+
 void StatelessObserverImpl::observeSolution (
   double stamp,
   const Thyra_Vector &nonOverlappedSolution,
@@ -47,6 +58,9 @@ void StatelessObserverImpl::observeSolution (
   const Teuchos::Ptr<const Thyra_Vector>& nonOverlappedSolutionDot)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  if (skipSolutionOutput()) return;
+  MemoryPhase memoryPhase("Output");
+
   const Teuchos::RCP<const Thyra_Vector> overlappedSolution =
     app_->getAdaptSolMgr()->updateAndReturnOverlapSolution(nonOverlappedSolution);
   Teuchos::RCP<Thyra_MultiVector> overlappedSolutionDxDp = Teuchos::null;
@@ -84,6 +98,9 @@ void StatelessObserverImpl::observeSolution (
   const Teuchos::Ptr<const Thyra_Vector>& nonOverlappedSolutionDotDot)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  if (skipSolutionOutput()) return;
+  MemoryPhase memoryPhase("Output");
+
   const Teuchos::RCP<const Thyra_Vector> overlappedSolution =
     app_->getAdaptSolMgr()->updateAndReturnOverlapSolution(nonOverlappedSolution);
   Teuchos::RCP<Thyra_MultiVector> overlappedSolutionDxDp = Teuchos::null;
@@ -116,6 +133,9 @@ void StatelessObserverImpl::observeSolution (
   const Teuchos::Ptr<const Thyra_MultiVector> &nonOverlappedSolution_dxdp)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
+  if (skipSolutionOutput()) return;
+  MemoryPhase memoryPhase("Output");
+
   const Teuchos::RCP<const Thyra_MultiVector> overlappedSolution =
     app_->getAdaptSolMgr()->updateAndReturnOverlapSolutionMV(nonOverlappedSolution);
   Teuchos::RCP<Thyra_MultiVector> overlappedSolutionDxDp = Teuchos::null;
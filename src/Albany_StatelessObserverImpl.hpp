@@ -75,6 +75,10 @@ public:
     const Teuchos::Ptr<const Thyra_MultiVector>& nonOverlappedSolution_dxdp);
 
 protected:
+  //! If the discretization writes nothing at this step, advance its output
+  //! counters and return true
+  bool skipSolutionOutput() const;
+
   Teuchos::RCP<Application> app_;
   Teuchos::RCP<Teuchos::Time> solOutTime_;
 };
@@ -18,13 +18,16 @@
 #endif
 #endif
 
+#include <algorithm>
 #include <cstdlib>
 #include <stdexcept>
 #include <time.h>
 
 #include "MatrixMarket_Tpetra.hpp"
+#include "Teuchos_CommHelpers.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Kokkos_Macros.hpp"
+#include "Kokkos_ArithTraits.hpp"
 
 // For vtune
 #include <sys/types.h>
@@ -152,35 +155,70 @@ getParameterSizes(const Teuchos::ParameterList parameterParams, int &total_num_p
   }
 }
 
+// The following row utilities work directly on the local (device) views
+// of the matrix, one row per thread, with no per-row allocation.
+
 void
 ReplaceDiagonalEntries(
     const Teuchos::RCP<Tpetra_CrsMatrix>& matrix,
     const Teuchos::RCP<Tpetra_Vector>&    diag)
 {
-  Teuchos::ArrayRCP<const ST> diag_constView = diag->get1dView();
-  for (size_t i = 0; i < matrix->getNodeNumRows(); i++) {
-    auto               NumEntries = matrix->getNumEntriesInLocalRow(i);
-    Teuchos::Array<LO> Indices(NumEntries);
-    Teuchos::Array<ST> Values(NumEntries);
-    matrix->getLocalRowCopy(i, Indices(), Values(), NumEntries);
-    GO global_row = matrix->getRowMap()->getGlobalElement(i);
-    for (size_t j = 0; j < NumEntries; j++) {
-      GO global_col = matrix->getColMap()->getGlobalElement(Indices[j]);
-      if (global_row == global_col) {
-        Teuchos::Array<ST> matrixEntriesT(1);
-        Teuchos::Array<LO> matrixIndicesT(1);
-        matrixEntriesT[0] = diag_constView[i];
-        matrixIndicesT[0] = Indices[j];
-        matrix->replaceLocalValues(i, matrixIndicesT(), matrixEntriesT());
+  const auto local_mat = matrix->getLocalMatrix();
+  const auto row_map   = matrix->getRowMap()->getLocalMap();
+  const auto col_map   = matrix->getColMap()->getLocalMap();
+  const auto diag_view = Kokkos::subview(diag->getLocalView<KokkosNode::execution_space>(), Kokkos::ALL(), 0);
+
+  const LO num_rows = local_mat.numRows();
+  Kokkos::parallel_for("Albany::ReplaceDiagonalEntries",
+                       Kokkos::RangePolicy<KokkosNode::execution_space>(0,num_rows),
+                       KOKKOS_LAMBDA(const LO row) {
+    // Locate the diagonal by local column index
+    const LO diag_col = col_map.getLocalElement(row_map.getGlobalElement(row));
+    auto row_view = local_mat.row(row);
+    for (LO j = 0; j < row_view.length; ++j) {
+      if (row_view.colidx(j) == diag_col) {
+        row_view.value(j) = diag_view(row);
       }
     }
-  }
+  });
 }
 
+namespace {
+
+// Computes sum_j |A_ij| for all local rows i, and stores either it or its
+// inverse (0 if the row sum is numerically zero) in the input vector.
+void
+absRowSumImpl(
+    const Teuchos::RCP<Tpetra_Vector>&          rowSums,
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix,
+    const bool                                  invert)
+{
+  const auto local_mat = matrix->getLocalMatrix();
+  const auto sums_view = Kokkos::subview(rowSums->getLocalView<KokkosNode::execution_space>(), Kokkos::ALL(), 0);
+
+  const LO num_rows = local_mat.numRows();
+  Kokkos::parallel_for("Albany::AbsRowSum",
+                       Kokkos::RangePolicy<KokkosNode::execution_space>(0,num_rows),
+                       KOKKOS_LAMBDA(const LO row) {
+    const auto row_view = local_mat.rowConst(row);
+    ST scale = 0.0;
+    for (LO j = 0; j < row_view.length; ++j) {
+      scale += Kokkos::ArithTraits<ST>::abs(row_view.value(j));
+    }
+    if (invert) {
+      sums_view(row) = scale < 1.0e-16 ? 0.0 : 1.0 / scale;
+    } else {
+      sums_view(row) = scale;
+    }
+  });
+}
+
+} // anonymous namespace
+
 void
 InvAbsRowSum(
-    Teuchos::RCP<Tpetra_Vector>&         invAbsRowSumsTpetra,
-    const Teuchos::RCP<Tpetra_CrsMatrix> matrix)
+    const Teuchos::RCP<Tpetra_Vector>&          invAbsRowSumsTpetra,
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix)
 {
   // Check that invAbsRowSumsTpetra and matrix have same map
   ALBANY_ASSERT(
@@ -188,47 +226,112 @@ InvAbsRowSum(
       "Error in Albany::InvAbsRowSum!  "
       "Input vector must have same map as row map of input matrix!");
 
-  invAbsRowSumsTpetra->putScalar(0.0);
-  Teuchos::ArrayRCP<double> invAbsRowSumsTpetra_nonconstView =
-      invAbsRowSumsTpetra->get1dViewNonConst();
-  for (size_t row = 0; row < invAbsRowSumsTpetra->getLocalLength(); row++) {
-    auto               numEntriesRow = matrix->getNumEntriesInLocalRow(row);
-    Teuchos::Array<LO> indices(numEntriesRow);
-    Teuchos::Array<ST> values(numEntriesRow);
-    matrix->getLocalRowCopy(row, indices(), values(), numEntriesRow);
-    ST scale = 0.0;
-    for (size_t j = 0; j < numEntriesRow; j++) { scale += std::abs(values[j]); }
-
-    if (scale < 1.0e-16) {
-      invAbsRowSumsTpetra_nonconstView[row] = 0.0;
-    } else {
-      invAbsRowSumsTpetra_nonconstView[row] = 1.0 / scale;
-    }
-  }
+  absRowSumImpl(invAbsRowSumsTpetra, matrix, true);
 }
 
 void
 AbsRowSum(
-    Teuchos::RCP<Tpetra_Vector>&         absRowSumsTpetra,
-    const Teuchos::RCP<Tpetra_CrsMatrix> matrix)
+    const Teuchos::RCP<Tpetra_Vector>&          absRowSumsTpetra,
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix)
 {
   // Check that absRowSumsTpetra and matrix have same map
   ALBANY_ASSERT(
       absRowSumsTpetra->getMap()->isSameAs(*(matrix->getRowMap())),
       "Error in Albany::AbsRowSum!  "
       "Input vector must have same map as row map of input matrix!");
-  absRowSumsTpetra->putScalar(0.0);
-  Teuchos::ArrayRCP<double> absRowSumsTpetra_nonconstView =
-      absRowSumsTpetra->get1dViewNonConst();
-  for (size_t row = 0; row < absRowSumsTpetra->getLocalLength(); row++) {
-    auto               numEntriesRow = matrix->getNumEntriesInLocalRow(row);
-    Teuchos::Array<LO> indices(numEntriesRow);
-    Teuchos::Array<ST> values(numEntriesRow);
-    matrix->getLocalRowCopy(row, indices(), values(), numEntriesRow);
-    ST scale = 0.0;
-    for (size_t j = 0; j < numEntriesRow; j++) { scale += std::abs(values[j]); }
-    absRowSumsTpetra_nonconstView[row] = scale;
-  }
+
+  absRowSumImpl(absRowSumsTpetra, matrix, false);
+}
+
+void
+LeftScale(
+    const Teuchos::RCP<Tpetra_CrsMatrix>&    matrix,
+    const Teuchos::RCP<const Tpetra_Vector>& scaling)
+{
+  const auto local_mat    = matrix->getLocalMatrix();
+  const auto scaling_view = Kokkos::subview(scaling->getLocalView<KokkosNode::execution_space>(), Kokkos::ALL(), 0);
+
+  const LO num_rows = local_mat.numRows();
+  Kokkos::parallel_for("Albany::LeftScale",
+                       Kokkos::RangePolicy<KokkosNode::execution_space>(0,num_rows),
+                       KOKKOS_LAMBDA(const LO row) {
+    auto row_view = local_mat.row(row);
+    const ST s = scaling_view(row);
+    for (LO j = 0; j < row_view.length; ++j) {
+      row_view.value(j) *= s;
+    }
+  });
+}
+
+void
+ComputeScalingAndLeftScale(
+    const Teuchos::RCP<Tpetra_Vector>&     scaling,
+    const Teuchos::RCP<Tpetra_CrsMatrix>&  matrix,
+    const bool                             useDiagonal)
+{
+  ALBANY_ASSERT(
+      scaling->getMap()->isSameAs(*(matrix->getRowMap())),
+      "Error in Albany::ComputeScalingAndLeftScale!  "
+      "Input vector must have same map as row map of input matrix!");
+
+  const auto local_mat    = matrix->getLocalMatrix();
+  const auto row_map      = matrix->getRowMap()->getLocalMap();
+  const auto col_map      = matrix->getColMap()->getLocalMap();
+  const auto scaling_view = Kokkos::subview(scaling->getLocalView<KokkosNode::execution_space>(), Kokkos::ALL(), 0);
+
+  // A single pass per row: compute the scaling factor, then scale the row
+  const LO num_rows = local_mat.numRows();
+  Kokkos::parallel_for("Albany::ComputeScalingAndLeftScale",
+                       Kokkos::RangePolicy<KokkosNode::execution_space>(0,num_rows),
+                       KOKKOS_LAMBDA(const LO row) {
+    auto row_view = local_mat.row(row);
+    ST s = 0.0;
+    if (useDiagonal) {
+      const LO diag_col = col_map.getLocalElement(row_map.getGlobalElement(row));
+      for (LO j = 0; j < row_view.length; ++j) {
+        if (row_view.colidx(j) == diag_col) {
+          s = 1.0 / row_view.value(j);
+        }
+      }
+    } else {
+      ST sum = 0.0;
+      for (LO j = 0; j < row_view.length; ++j) {
+        sum += Kokkos::ArithTraits<ST>::abs(row_view.value(j));
+      }
+      s = sum < 1.0e-16 ? 0.0 : 1.0 / sum;
+    }
+    scaling_view(row) = s;
+    for (LO j = 0; j < row_view.length; ++j) {
+      row_view.value(j) *= s;
+    }
+  });
+}
+
+ST
+SampledAbsRowSumNorm(
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix,
+    const int                                   numSamples)
+{
+  const auto local_mat = matrix->getLocalMatrix();
+
+  // Sample (up to) numSamples rows, evenly spaced in the local rows
+  const LO num_rows = local_mat.numRows();
+  const LO stride   = std::max(num_rows / std::max(numSamples,1), 1);
+  const LO num_sampled = num_rows>0 ? 1 + (num_rows-1)/stride : 0;
+
+  ST local_norm = 0.0;
+  Kokkos::parallel_reduce("Albany::SampledAbsRowSumNorm",
+                          Kokkos::RangePolicy<KokkosNode::execution_space>(0,num_sampled),
+                          KOKKOS_LAMBDA(const LO i, ST& norm) {
+    const auto row_view = local_mat.rowConst(i*stride);
+    for (LO j = 0; j < row_view.length; ++j) {
+      norm += Kokkos::ArithTraits<ST>::abs(row_view.value(j));
+    }
+  }, local_norm);
+
+  ST global_norm = 0.0;
+  Teuchos::reduceAll(*matrix->getComm(), Teuchos::REDUCE_SUM, 1, &local_norm, &global_norm);
+  return global_norm;
 }
 
 std::string
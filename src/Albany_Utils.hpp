@@ -43,21 +43,38 @@ ReplaceDiagonalEntries(
 // of a matrix, takes its inverse, and puts it in a vector.
 void
 InvAbsRowSum(
-    Teuchos::RCP<Tpetra_Vector>&         invAbsRowSumsTpetra,
-    const Teuchos::RCP<Tpetra_CrsMatrix> matrix);
+    const Teuchos::RCP<Tpetra_Vector>&          invAbsRowSumsTpetra,
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix);
 
 // Helper function which computes absolute values of the rowsum
 // of a matrix, and puts it in a vector.
 void
 AbsRowSum(
-    Teuchos::RCP<Tpetra_Vector>&         absRowSumsTpetra,
-    const Teuchos::RCP<Tpetra_CrsMatrix> matrix);
+    const Teuchos::RCP<Tpetra_Vector>&          absRowSumsTpetra,
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix);
 
-// Helper function which replaces the diagonal of a matrix
+// Helper function which scales the i-th row of a matrix by the i-th entry of a vector
 void
-ReplaceDiagonalEntries(
-    const Teuchos::RCP<Tpetra_CrsMatrix>& matrix,
-    const Teuchos::RCP<Tpetra_Vector>&    diag);
+LeftScale(
+    const Teuchos::RCP<Tpetra_CrsMatrix>&    matrix,
+    const Teuchos::RCP<const Tpetra_Vector>& scaling);
+
+// Helper function which computes the inverse of the diagonal (or of the
+// absolute row sum) of a matrix, puts it in a vector, and left-scales
+// the matrix with it, all in one pass over the matrix.
+void
+ComputeScalingAndLeftScale(
+    const Teuchos::RCP<Tpetra_Vector>&     scaling,
+    const Teuchos::RCP<Tpetra_CrsMatrix>&  matrix,
+    const bool                             useDiagonal);
+
+// Helper function which returns the sum over all ranks of the absolute
+// row sums of (up to) numSamples local rows. Meant as a cheap indicator
+// of how much a matrix changed.
+ST
+SampledAbsRowSumNorm(
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& matrix,
+    const int                                   numSamples);
 
 //! Utility to make a string out of a string + int with a delimiter:
 //! strint("dog",2,' ') = "dog 2"
@@ -6,6 +6,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -50,6 +51,8 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename EvalT, typename Traits>
 void AnalyticIceGeometry<EvalT, Traits>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   for (int cell=0; cell < workset.numCells; ++cell)
   {
     for (int qp=0; qp < numQp; ++qp)
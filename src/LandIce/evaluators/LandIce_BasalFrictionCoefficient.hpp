@@ -14,6 +14,7 @@
 
 #include "Albany_Layouts.hpp"
 #include "Albany_ScalarOrdinalTypes.hpp"
+#include "Albany_DiscretizationUtils.hpp"
 #include "PHAL_Utilities.hpp"
 #include "PHAL_Dimension.hpp"
 
@@ -106,6 +107,22 @@ private:
   BETA_TYPE beta_type;
 
   PHAL::MDFieldMemoizer<Traits> memoizer;
+
+  // Scalar coefficients of the current evaluation (used by the side kernel)
+  ScalarT mu_val, lambda_val, power_val;
+
+  Albany::LocalSideSetInfo sideSet;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct BasalFrictionCoefficient_Side_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,BasalFrictionCoefficient_Side_Tag> BasalFrictionCoefficient_Side_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const BasalFrictionCoefficient_Side_Tag& tag, const int& sideSet_idx) const;
 };
 
 } // Namespace LandIce
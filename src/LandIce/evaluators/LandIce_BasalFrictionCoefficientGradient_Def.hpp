@@ -16,6 +16,7 @@
 #include "LandIce_ParamEnum.hpp"
 
 #include <string.hpp> // for 'upper_case' (comes from src/utility; not to be confused with <string>)
+#include "PHAL_EvaluatorMonitor.hpp"
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
 
@@ -152,6 +153,8 @@ postRegistrationSetup (typename Traits::SetupData d,
 template<typename EvalT, typename Traits>
 void BasalFrictionCoefficientGradient<EvalT, Traits>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   TEUCHOS_TEST_FOR_EXCEPTION (beta_type==INVALID, Teuchos::Exceptions::InvalidParameter,
       std::endl << "Error in LandIce::BasalFrictionCoefficientGradient: cannot compute the gradient of this type of beta.");
 
@@ -15,6 +15,7 @@
 #include "LandIce_BasalFrictionCoefficient.hpp"
 
 #include <string.hpp> // for 'upper_case' (comes from src/utility; not to be confused with <string>)
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -233,6 +234,8 @@ template<typename EvalT, typename Traits, typename EffPressureST, typename Veloc
 void BasalFrictionCoefficient<EvalT, Traits, EffPressureST, VelocityST, TemperatureST>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields()))
     return;
 
@@ -326,136 +329,151 @@ evaluateFields (typename Traits::EvalData workset)
 }
 
 template<typename EvalT, typename Traits, typename EffPressureST, typename VelocityST, typename TemperatureST>
+KOKKOS_INLINE_FUNCTION
 void BasalFrictionCoefficient<EvalT, Traits, EffPressureST, VelocityST, TemperatureST>::
-evaluateFieldsSide (typename Traits::EvalData workset, ScalarT mu, ScalarT lambda, ScalarT power)
+operator() (const BasalFrictionCoefficient_Side_Tag& tag, const int& sideSet_idx) const
 {
-  if (workset.sideSets->find(basalSideName)==workset.sideSets->end())
-    return;
+  // Get the local data of side and cell
+  const int cell = sideSet.elem_LID(sideSet_idx);
+  const int side = sideSet.side_local_id(sideSet_idx);
 
   const int dim = nodal ? numNodes : numQPs;
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(basalSideName);
-  for (auto const& it_side : sideSet) {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
+  switch (beta_type) {
+    case GIVEN_CONSTANT:
+      break;    // Never reached, see evaluateFieldsSide
 
-    switch (beta_type) {
-      case GIVEN_CONSTANT:
-        return;   // We can save ourself some useless iterations
+    case GIVEN_FIELD:
+      if (is_given_field_param) {
+        for (int ipt=0; ipt<dim; ++ipt) {
+          beta(cell,side,ipt) = given_field_param(cell,side,ipt);
+        }
+      } else {
+        for (int ipt=0; ipt<dim; ++ipt) {
+          beta(cell,side,ipt) = given_field(cell,side,ipt);
+        }
+      }
+      break;
 
-      case GIVEN_FIELD:
-        if (is_given_field_param) {
+    case POWER_LAW:
+      if (distributedMu) {
+        for (int ipt=0; ipt<dim; ++ipt) {
+          ScalarT Nval = std::max(N(cell,side,ipt),0.0);
+          beta(cell,side,ipt) = muPowerLawField(cell,side,ipt) * Nval * std::pow (u_norm(cell,side,ipt), power_val-1);
+        }
+      } else {
+        for (int ipt=0; ipt<dim; ++ipt) {
+          ScalarT Nval = std::max(N(cell,side,ipt),0.0);
+          beta(cell,side,ipt) = mu_val * Nval * std::pow (u_norm(cell,side,ipt), power_val-1);
+        }
+      }
+
+      break;
+
+    case REGULARIZED_COULOMB:
+      if (distributedLambda) {
+        if (distributedMu) {
           for (int ipt=0; ipt<dim; ++ipt) {
-            beta(cell,side,ipt) = given_field_param(cell,side,ipt);
+            ScalarT Nval = std::max(N(cell,side,ipt),0.0);
+            ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambdaField(cell,side,ipt)*ice_softness(cell,side)*std::pow(Nval,n) );
+            beta(cell,side,ipt) = muCoulombField(cell,side,ipt) * Nval * std::pow( q, power_val) / u_norm(cell,side,ipt);
           }
         } else {
           for (int ipt=0; ipt<dim; ++ipt) {
-            beta(cell,side,ipt) = given_field(cell,side,ipt);
+            ScalarT Nval = std::max(N(cell,side,ipt),0.0);
+            ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambdaField(cell,side,ipt)*ice_softness(cell,side)*std::pow(Nval,n) );
+            beta(cell,side,ipt) = mu_val * Nval * std::pow( q, power_val) / u_norm(cell,side,ipt);
           }
         }
-        break;
-
-      case POWER_LAW:
+      } else {
         if (distributedMu) {
           for (int ipt=0; ipt<dim; ++ipt) {
             ScalarT Nval = std::max(N(cell,side,ipt),0.0);
-            beta(cell,side,ipt) = muPowerLawField(cell,side,ipt) * Nval * std::pow (u_norm(cell,side,ipt), power-1);
+            ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambda_val*ice_softness(cell,side)*std::pow(Nval,n) );
+            beta(cell,side,ipt) = muCoulombField(cell,side,ipt) * Nval * std::pow( q, power_val) / u_norm(cell,side,ipt);
           }
         } else {
           for (int ipt=0; ipt<dim; ++ipt) {
             ScalarT Nval = std::max(N(cell,side,ipt),0.0);
-            beta(cell,side,ipt) = mu * Nval * std::pow (u_norm(cell,side,ipt), power-1);
+            ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambda_val*ice_softness(cell,side)*std::pow(Nval,n) );
+            beta(cell,side,ipt) = mu_val * Nval * std::pow( q, power_val) / u_norm(cell,side,ipt);
           }
         }
+      }
+      break;
 
-        break;
-
-      case REGULARIZED_COULOMB:
-        if (distributedLambda) {
-          if (distributedMu) {
-            for (int ipt=0; ipt<dim; ++ipt) {
-              ScalarT Nval = std::max(N(cell,side,ipt),0.0);
-              ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambdaField(cell,side,ipt)*ice_softness(cell,side)*std::pow(Nval,n) );
-              beta(cell,side,ipt) = muCoulombField(cell,side,ipt) * Nval * std::pow( q, power) / u_norm(cell,side,ipt);
-            }
-          } else {
-            for (int ipt=0; ipt<dim; ++ipt) {
-              ScalarT Nval = std::max(N(cell,side,ipt),0.0);
-              ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambdaField(cell,side,ipt)*ice_softness(cell,side)*std::pow(Nval,n) );
-              beta(cell,side,ipt) = mu * Nval * std::pow( q, power) / u_norm(cell,side,ipt);
-            }
+    case EXP_GIVEN_FIELD:
+      if(nodal || interpolate_then_exponentiate) {
+        if (is_given_field_param) {
+          for (int ipt=0; ipt<dim; ++ipt) {
+            beta(cell,side,ipt) = std::exp(given_field_param(cell,side,ipt));
           }
         } else {
-          if (distributedMu) {
-            for (int ipt=0; ipt<dim; ++ipt) {
-              ScalarT Nval = std::max(N(cell,side,ipt),0.0);
-              ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambda*ice_softness(cell,side)*std::pow(Nval,n) );
-              beta(cell,side,ipt) = muCoulombField(cell,side,ipt) * Nval * std::pow( q, power) / u_norm(cell,side,ipt);
-            }
-          } else {
-            for (int ipt=0; ipt<dim; ++ipt) {
-              ScalarT Nval = std::max(N(cell,side,ipt),0.0);
-              ScalarT q = u_norm(cell,side,ipt) / ( u_norm(cell,side,ipt) + lambda*ice_softness(cell,side)*std::pow(Nval,n) );
-              beta(cell,side,ipt) = mu * Nval * std::pow( q, power) / u_norm(cell,side,ipt);
-            }
+          for (int ipt=0; ipt<dim; ++ipt) {
+            beta(cell,side,ipt) = std::exp(given_field(cell,side,ipt));
           }
         }
-        break;
-
-      case EXP_GIVEN_FIELD:
-        if(nodal || interpolate_then_exponentiate) {
-          if (is_given_field_param) {
-            for (int ipt=0; ipt<dim; ++ipt) {
-              beta(cell,side,ipt) = std::exp(given_field_param(cell,side,ipt));
-            }
-          } else {
-            for (int ipt=0; ipt<dim; ++ipt) {
-              beta(cell,side,ipt) = std::exp(given_field(cell,side,ipt));
-            }
+      } else {
+        if (is_given_field_param) {
+          for (int qp=0; qp<numQPs; ++qp) {
+            beta(cell,side,qp) = 0;
+            for (int node=0; node<numNodes; ++node)
+              beta(cell,side,qp) += std::exp(given_field_param(cell,side,node))*BF(cell,side,node,qp);
           }
         } else {
-          if (is_given_field_param) {
-            for (int qp=0; qp<numQPs; ++qp) {
-              beta(cell,side,qp) = 0;
-              for (int node=0; node<numNodes; ++node)
-                beta(cell,side,qp) += std::exp(given_field_param(cell,side,node))*BF(cell,side,node,qp);
-            }
-          } else {
-            for (int qp=0; qp<numQPs; ++qp) {
-              beta(cell,side,qp) = 0;
-              for (int node=0; node<numNodes; ++node)
-                beta(cell,side,qp) += std::exp(given_field(cell,side,node))*BF(cell,side,node,qp);
-            }
+          for (int qp=0; qp<numQPs; ++qp) {
+            beta(cell,side,qp) = 0;
+            for (int node=0; node<numNodes; ++node)
+              beta(cell,side,qp) += std::exp(given_field(cell,side,node))*BF(cell,side,node,qp);
           }
         }
-        break;
-     }
-
-    if(zero_on_floating) {
-      if (is_thickness_param) {
-        for (int ipt=0; ipt<dim; ++ipt) {
-          ParamScalarT isGrounded = rho_i*thickness_param_field(cell,side,ipt) > -rho_w*bed_topo_field(cell,side,ipt);
-          beta(cell,side,ipt) *=  isGrounded;
-        }
-      } else {
-        for (int ipt=0; ipt<dim; ++ipt) {
-          ParamScalarT isGrounded = rho_i*thickness_field(cell,side,ipt) > -rho_w*bed_topo_field(cell,side,ipt);
-          beta(cell,side,ipt) *=  isGrounded;
-        }
       }
-    }
+      break;
+  }
 
-    // Correct the value if we are using a stereographic map
-    if (use_stereographic_map) {
+  if(zero_on_floating) {
+    if (is_thickness_param) {
       for (int ipt=0; ipt<dim; ++ipt) {
-        MeshScalarT x = coordVec(cell,side,ipt,0) - x_0;
-        MeshScalarT y = coordVec(cell,side,ipt,1) - y_0;
-        MeshScalarT h = 4.0*R2/(4.0*R2 + x*x + y*y);
-        beta(cell,side,ipt) *= h*h;
+        ParamScalarT isGrounded = rho_i*thickness_param_field(cell,side,ipt) > -rho_w*bed_topo_field(cell,side,ipt);
+        beta(cell,side,ipt) *=  isGrounded;
+      }
+    } else {
+      for (int ipt=0; ipt<dim; ++ipt) {
+        ParamScalarT isGrounded = rho_i*thickness_field(cell,side,ipt) > -rho_w*bed_topo_field(cell,side,ipt);
+        beta(cell,side,ipt) *=  isGrounded;
       }
     }
   }
+
+  // Correct the value if we are using a stereographic map
+  if (use_stereographic_map) {
+    for (int ipt=0; ipt<dim; ++ipt) {
+      MeshScalarT x = coordVec(cell,side,ipt,0) - x_0;
+      MeshScalarT y = coordVec(cell,side,ipt,1) - y_0;
+      MeshScalarT h = 4.0*R2/(4.0*R2 + x*x + y*y);
+      beta(cell,side,ipt) *= h*h;
+    }
+  }
+}
+
+template<typename EvalT, typename Traits, typename EffPressureST, typename VelocityST, typename TemperatureST>
+void BasalFrictionCoefficient<EvalT, Traits, EffPressureST, VelocityST, TemperatureST>::
+evaluateFieldsSide (typename Traits::EvalData workset, ScalarT mu, ScalarT lambda, ScalarT power)
+{
+  if (workset.sideSetViews->find(basalSideName)==workset.sideSetViews->end())
+    return;
+
+  // We can save ourself some useless iterations
+  if (beta_type==GIVEN_CONSTANT)
+    return;
+
+  mu_val     = mu;
+  lambda_val = lambda;
+  power_val  = power;
+
+  sideSet = workset.sideSetViews->at(basalSideName);
+
+  Kokkos::parallel_for(BasalFrictionCoefficient_Side_Policy(0, sideSet.size), *this);
 }
 
 template<typename EvalT, typename Traits, typename EffPressureST, typename VelocityST, typename TemperatureST>
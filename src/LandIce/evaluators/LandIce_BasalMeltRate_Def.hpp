@@ -13,6 +13,7 @@
 
 #include "Albany_DiscretizationUtils.hpp"
 #include "LandIce_BasalMeltRate.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -191,6 +192,8 @@ template<typename EvalT, typename Traits, typename VelocityST, typename MeltEnth
 void BasalMeltRate<EvalT,Traits,VelocityST,MeltEnthST>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   TEUCHOS_TEST_FOR_EXCEPTION (workset.sideSetViews==Teuchos::null, std::runtime_error,
                               "Side set views defined in input file but not properly specified on the mesh.\n");
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
@@ -11,6 +11,7 @@
 
 #include "Albany_Layouts.hpp"
 #include "LandIce_CismSurfaceGradFO.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -60,6 +61,8 @@ template<typename EvalT, typename Traits>
 void CismSurfaceGradFO<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < numQPs; ++qp) {
       gradS_qp(cell,qp,0) = dsdx_node(cell, 0) * BF(cell, 0, qp);
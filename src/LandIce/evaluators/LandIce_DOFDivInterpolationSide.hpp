@@ -38,6 +38,7 @@ private:
   typedef typename Albany::StrongestScalarType<ScalarT,MeshScalarT>::type OutputScalarT;
 
   std::string sideSetName;
+  int         sideSetId;
 
   // Input:
   //! Values at nodes
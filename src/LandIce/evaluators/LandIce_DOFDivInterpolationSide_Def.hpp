@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -45,6 +46,8 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(tangents,fm);
   this->utils.setFieldData(val_qp,fm);
 
+  sideSetId = d.get_side_set_id(sideSetName);
+
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
   if (d.memoizer_active()) memoizer.enable_memoizer();
 }
@@ -54,12 +57,14 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFDivInterpolationSideBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
+  if (sideSetId<0 || (*workset.indexedSideSets)[sideSetId].empty())
     return;
 
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
+  const std::vector<Albany::SideStruct>& sideSet = (*workset.indexedSideSets)[sideSetId];
   for (auto const& it_side : sideSet)
   {
     // Get the local data of side and cell
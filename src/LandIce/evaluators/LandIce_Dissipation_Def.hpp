@@ -9,6 +9,7 @@
 #include "Teuchos_VerboseObject.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -62,6 +63,7 @@ namespace LandIce
   void Dissipation<EvalT,Traits>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL_MONITOR_EVALUATOR(EvalT,workset);
     
     if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
@@ -9,6 +9,7 @@
 #include "Teuchos_VerboseObject.hpp"
 
 #include "LandIce_ParamEnum.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 //uncomment the following line if you want debug output to be printed to screen
 // #define OUTPUT_TO_SCREEN
 
@@ -76,6 +77,8 @@ template<typename EvalT, typename Traits, bool IsStokes, bool Surrogate>
 void EffectivePressure<EvalT, Traits, IsStokes, Surrogate>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokes) {
     evaluateFieldsSide(workset);
   } else {
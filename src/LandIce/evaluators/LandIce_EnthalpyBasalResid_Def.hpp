@@ -15,6 +15,7 @@
 #include "Albany_DiscretizationUtils.hpp"
 
 #include "Shards_CellTopology.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -137,6 +138,8 @@ template<typename EvalT, typename Traits, typename Type>
 void EnthalpyBasalResid<EvalT,Traits,Type>::
 evaluateFields(typename Traits::EvalData d)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,d);
+
   // Zero out, to avoid leaving stuff from previous workset!
   enthalpyBasalResid.deep_copy(0);
 
@@ -12,6 +12,7 @@
 #include "Albany_KokkosUtils.hpp"
 
 #include "LandIce_EnthalpyResid.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -310,6 +311,8 @@ template<typename EvalT, typename Traits, typename VelocityST, typename MeltTemp
 void EnthalpyResid<EvalT,Traits,VelocityST,MeltTempST>::
 evaluateFields(typename Traits::EvalData d)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,d);
+
   ScalarT K;
   double pi = atan(1.) * 4.;
   ScalarT hom = homotopy(0);
@@ -8,6 +8,7 @@
 #include "Phalanx_Print.hpp"
 
 #include "LandIce_FlowRate.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -86,6 +87,8 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename EvalT, typename Traits>
 void FlowRate<EvalT, Traits>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   switch (flowRate_type)
   {
     case UNIFORM:
@@ -10,6 +10,7 @@
 #include "Teuchos_CommHelpers.hpp"
 
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits, typename ThicknessScalarT>
 LandIce::FluxDiv<EvalT, Traits, ThicknessScalarT>::
@@ -72,6 +73,8 @@ void LandIce::FluxDiv<EvalT, Traits, ThicknessScalarT>::postRegistrationSetup(ty
 template<typename EvalT, typename Traits, typename ThicknessScalarT>
 void LandIce::FluxDiv<EvalT, Traits, ThicknessScalarT>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   TEUCHOS_TEST_FOR_EXCEPTION (workset.sideSets==Teuchos::null, std::runtime_error,
                               "Side sets defined in input file but not properly specified on the mesh.\n");
 
@@ -13,6 +13,7 @@
 
 #include "LandIce_FluxDivergenceResidual.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 
 template<typename EvalT, typename Traits, typename ThicknessScalarT>
@@ -64,6 +65,8 @@ postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& f
 template<typename EvalT, typename Traits, typename ThicknessScalarT>
 void LandIce::LayeredFluxDivergenceResidual<EvalT, Traits, ThicknessScalarT>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   using std::sqrt;
   using std::pow;
 
@@ -310,6 +313,8 @@ postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& f
 template<typename EvalT, typename Traits>
 void LandIce::FluxDivergenceResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   using std::sqrt;
   using std::pow;
 
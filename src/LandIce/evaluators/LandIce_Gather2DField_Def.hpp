@@ -15,6 +15,7 @@
 #include "Albany_GlobalLocalIndexer.hpp"
 
 #include "LandIce_Gather2DField.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -79,6 +80,8 @@ template<typename Traits>
 void Gather2DField<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
@@ -119,6 +122,8 @@ template<typename Traits>
 void Gather2DField<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
@@ -181,6 +186,8 @@ template<typename Traits>
 void Gather2DField<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
   Teuchos::RCP<const Thyra_MultiVector> direction_x = workset.hessianWorkset.direction_x;
@@ -268,6 +275,8 @@ template<typename Traits>
 void GatherExtruded2DField<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
   TEUCHOS_TEST_FOR_EXCEPTION (workset.disc->getLayeredMeshNumbering().is_null(),
@@ -304,6 +313,8 @@ template<typename Traits>
 void GatherExtruded2DField<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
@@ -368,6 +379,8 @@ template<typename Traits>
 void GatherExtruded2DField<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
   Teuchos::RCP<const Thyra_MultiVector> direction_x = workset.hessianWorkset.direction_x;
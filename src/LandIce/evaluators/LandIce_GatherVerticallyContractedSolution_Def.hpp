@@ -15,6 +15,7 @@
 #include "Albany_AbstractDiscretization.hpp"
 
 #include "LandIce_GatherVerticallyContractedSolution.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -93,6 +94,8 @@ template<typename Traits>
 void GatherVerticallyContractedSolution<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
   Kokkos::deep_copy(this->contractedSol.get_view(), ScalarT(0.0));
@@ -168,6 +171,8 @@ template<typename Traits>
 void GatherVerticallyContractedSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
   
   TEUCHOS_TEST_FOR_EXCEPTION(workset.sideSets.is_null(), std::logic_error,
@@ -251,6 +256,8 @@ template<typename Traits>
 void GatherVerticallyContractedSolution<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Tangent,workset);
+
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
   Kokkos::deep_copy(this->contractedSol.get_view(), ScalarT(0.0));
@@ -330,6 +337,8 @@ template<typename Traits>
 void GatherVerticallyContractedSolution<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
 
   Kokkos::deep_copy(this->contractedSol.get_view(), ScalarT(0.0));
@@ -407,6 +416,8 @@ template<typename Traits>
 void GatherVerticallyContractedSolution<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   Teuchos::ArrayRCP<const ST> x_constView = Albany::getLocalData(workset.x);
   Teuchos::RCP<const Thyra_MultiVector> direction_x = workset.hessianWorkset.direction_x;
   Teuchos::ArrayRCP<const ST> direction_x_constView;
@@ -6,6 +6,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -77,6 +78,8 @@ template<typename EvalT, typename Traits, bool IsStokes>
 void HydraulicPotential<EvalT, Traits, IsStokes>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokes) {
     evaluateFieldsSide(workset);
   } else {
@@ -7,6 +7,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
 #include "Teuchos_VerboseObject.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 #define OUTPUT_TO_SCREEN
@@ -65,6 +66,8 @@ template<typename EvalT, typename Traits, bool IsStokes>
 void BasalGravitationalWaterPotential<EvalT, Traits, IsStokes>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokes) {
     evaluateFieldsSide(workset);
   } else {
@@ -6,6 +6,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -100,6 +101,8 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename EvalT, typename Traits, bool IsStokes>
 void HydrologyMeltingRate<EvalT, Traits, IsStokes>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   // m = \frac{ G - \beta |u_b|^2 + \nabla (phiH-N)\cdot q }{L} %% The nonlinear term \nabla (phiH-N)\cdot q can be ignored
 
   if (IsStokes)
@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "Albany_DiscretizationUtils.hpp"
 
 namespace LandIce
 {
@@ -95,6 +96,19 @@ private:
   bool                            stokes_coupling;
   std::string                     sideSetName;
   std::vector<std::vector<int> >  sideNodes;
+
+  Albany::LocalSideSetInfo sideSet;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct HydrologyResidualCavitiesEqn_Side_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,HydrologyResidualCavitiesEqn_Side_Tag> HydrologyResidualCavitiesEqn_Side_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const HydrologyResidualCavitiesEqn_Side_Tag& tag, const int& sideSet_idx) const;
 };
 
 } // Namespace LandIce
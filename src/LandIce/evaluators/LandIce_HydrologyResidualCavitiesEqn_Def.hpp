@@ -6,6 +6,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -169,6 +170,8 @@ template<typename EvalT, typename Traits, bool IsStokes, bool ThermoCoupled>
 void HydrologyResidualCavitiesEqn<EvalT, Traits, IsStokes, ThermoCoupled>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokes) {
     evaluateFieldsSide(workset);
   } else {
@@ -177,48 +180,54 @@ evaluateFields (typename Traits::EvalData workset)
 }
 
 template<typename EvalT, typename Traits, bool IsStokes, bool ThermoCoupled>
+KOKKOS_INLINE_FUNCTION
 void HydrologyResidualCavitiesEqn<EvalT, Traits, IsStokes, ThermoCoupled>::
-evaluateFieldsSide (typename Traits::EvalData workset)
+operator() (const HydrologyResidualCavitiesEqn_Side_Tag& tag, const int& sideSet_idx) const
 {
   // h' = W_O - W_C = (m/rho_i + u_b*(h_b-h)/l_b) - AhN^n
   ScalarT res_node, res_qp, zero(0.0);
 
-  // Zero out, to avoid leaving stuff from previous workset!
-  residual.deep_copy(ScalarT(0.0));
+  // Get the local data of side and cell
+  const int cell = sideSet.elem_LID(sideSet_idx);
+  const int side = sideSet.side_local_id(sideSet_idx);
+
+  for (int node=0; node < numNodes; ++node) {
+    res_node = 0;
+    if (nodal_equation) {
+      res_node = (use_melting ? m(cell,side,node)/rho_i : zero)
+               + (h_r - h(cell,side,node))*u_b(cell,side,node)/l_r
+               - c_creep*h(cell,side,node)*ice_softness(cell)*std::pow(N(cell,side,node),3)
+               - (unsteady ? scaling_h_t*h_dot(cell,side,node) : zero)
+               + (has_p_dot ? -phi0*P_dot(cell,side,node) : zero);
+    } else {
+      for (int qp=0; qp < numQPs; ++qp) {
+        res_qp = (use_melting ? m(cell,side,qp)/rho_i : zero)
+               + (h_r - h(cell,side,qp))*u_b(cell,side,qp)/l_r
+               - c_creep*h(cell,side,qp)*ice_softness(cell,side)*std::pow(N(cell,side,qp),3)
+               - (unsteady ? scaling_h_t*h_dot(cell,side,qp) : zero)
+               + (has_p_dot ? -phi0*P_dot(cell,side,qp) : zero);
+
+        res_node += res_qp * BF(cell,side,node,qp) * w_measure(cell,side,qp);
+      }
+    }
 
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end()) {
-    return;
+    residual (cell,side,node) = res_node;
   }
+}
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
-  for (auto const& it_side : sideSet) {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
+template<typename EvalT, typename Traits, bool IsStokes, bool ThermoCoupled>
+void HydrologyResidualCavitiesEqn<EvalT, Traits, IsStokes, ThermoCoupled>::
+evaluateFieldsSide (typename Traits::EvalData workset)
+{
+  // Zero out, to avoid leaving stuff from previous workset!
+  residual.deep_copy(ScalarT(0.));
 
-    for (int node=0; node < numNodes; ++node) {
-      res_node = 0;
-      if (nodal_equation) {
-        res_node = (use_melting ? m(cell,side,node)/rho_i : zero)
-                 + (h_r - h(cell,side,node))*u_b(cell,side,node)/l_r
-                 - c_creep*h(cell,side,node)*ice_softness(cell)*std::pow(N(cell,side,node),3)
-                 - (unsteady ? scaling_h_t*h_dot(cell,side,node) : zero)
-                 + (has_p_dot ? -phi0*P_dot(cell,side,node) : zero);
-      } else {
-        for (int qp=0; qp < numQPs; ++qp) {
-          res_qp = (use_melting ? m(cell,side,qp)/rho_i : zero)
-                 + (h_r - h(cell,side,qp))*u_b(cell,side,qp)/l_r
-                 - c_creep*h(cell,side,qp)*ice_softness(cell,side)*std::pow(N(cell,side,qp),3)
-                 - (unsteady ? scaling_h_t*h_dot(cell,side,qp) : zero)
-                 + (has_p_dot ? -phi0*P_dot(cell,side,qp) : zero);
+  if (workset.sideSetViews->find(sideSetName)==workset.sideSetViews->end())
+    return;
 
-          res_node += res_qp * BF(cell,side,node,qp) * w_measure(cell,side,qp);
-        }
-      }
+  sideSet = workset.sideSetViews->at(sideSetName);
 
-      residual (cell,side,node) = res_node;
-    }
-  }
+  Kokkos::parallel_for(HydrologyResidualCavitiesEqn_Side_Policy(0, sideSet.size), *this);
 }
 
 template<typename EvalT, typename Traits, bool IsStokes, bool ThermoCoupled>
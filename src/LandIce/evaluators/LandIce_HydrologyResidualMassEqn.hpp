@@ -13,6 +13,7 @@
 #include "Phalanx_MDField.hpp"
 
 #include "Albany_Layouts.hpp"
+#include "Albany_DiscretizationUtils.hpp"
 #include "Albany_ScalarOrdinalTypes.hpp"
 #include "PHAL_Dimension.hpp"
 
@@ -97,7 +98,21 @@ private:
 
   // Variables necessary for stokes coupling
   std::string                     sideSetName;
+  int                             sideSetId;
   std::vector<std::vector<int> >  sideNodes;
+
+  Albany::LocalSideSetInfo sideSet;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct HydrologyResidualMassEqn_Side_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,HydrologyResidualMassEqn_Side_Tag> HydrologyResidualMassEqn_Side_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const HydrologyResidualMassEqn_Side_Tag& tag, const int& sideSet_idx) const;
 };
 
 } // Namespace LandIce
@@ -6,6 +6,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -151,6 +152,8 @@ postRegistrationSetup(typename Traits::SetupData d,
   if (IsStokesCoupling)
     this->utils.setFieldData(metric,fm);
 
+  sideSetId = d.get_side_set_id(sideSetName);
+
   if (unsteady) {
     this->utils.setFieldData(h_dot,fm);
     if (has_h_till) {
@@ -170,6 +173,8 @@ template<typename EvalT, typename Traits, bool IsStokesCoupling, bool ThermoCoup
 void HydrologyResidualMassEqn<EvalT, Traits, IsStokesCoupling, ThermoCoupled>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokesCoupling) {
     evaluateFieldsSide(workset);
   } else {
@@ -178,62 +183,69 @@ evaluateFields (typename Traits::EvalData workset)
 }
 
 template<typename EvalT, typename Traits, bool IsStokesCoupling, bool ThermoCoupled>
+KOKKOS_INLINE_FUNCTION
 void HydrologyResidualMassEqn<EvalT, Traits, IsStokesCoupling, ThermoCoupled>::
-evaluateFieldsSide (typename Traits::EvalData workset)
+operator() (const HydrologyResidualMassEqn_Side_Tag& tag, const int& sideSet_idx) const
 {
-  // Zero out, to avoid leaving stuff from previous workset!
-  residual.deep_copy(ScalarT(0.));
+  ScalarT res_qp, res_node;
 
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
-    return;
+  // Get the local data of side and cell
+  const int cell = sideSet.elem_LID(sideSet_idx);
+  const int side = sideSet.side_local_id(sideSet_idx);
 
-  ScalarT res_qp, res_node, zero(0);
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
-  for (auto const& it_side : sideSet)
+  for (int node=0; node < numNodes; ++node)
   {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
-
-    for (int node=0; node < numNodes; ++node)
+    res_node = 0;
+    for (int qp=0; qp < numQPs; ++qp)
     {
-      res_node = 0;
-      for (int qp=0; qp < numQPs; ++qp)
-      {
-        res_qp = scaling_omega*omega(cell,side,qp);
-        if (unsteady) {
-          res_qp -= scaling_h_dot*h_dot(cell,side,qp);
-          if (has_h_till) {
-            res_qp -= scaling_h_dot*h_till_dot(cell,side,qp);
-          }
+      res_qp = scaling_omega*omega(cell,side,qp);
+      if (unsteady) {
+        res_qp -= scaling_h_dot*h_dot(cell,side,qp);
+        if (has_h_till) {
+          res_qp -= scaling_h_dot*h_till_dot(cell,side,qp);
         }
+      }
 
-        if (use_melting && !mass_lumping) {
-          res_qp += m(cell,side,qp)/rho_w;
-        }
+      if (use_melting && !mass_lumping) {
+        res_qp += m(cell,side,qp)/rho_w;
+      }
 
-        res_qp *= BF(cell,side,node,qp);
+      res_qp *= BF(cell,side,node,qp);
 
-        for (int idim=0; idim<numDims; ++idim)
+      for (int idim=0; idim<numDims; ++idim)
+      {
+        for (int jdim=0; jdim<numDims; ++jdim)
         {
-          for (int jdim=0; jdim<numDims; ++jdim)
-          {
-            res_qp += scaling_q*q(cell,side,qp,idim) * metric(cell,side,qp,idim,jdim) * GradBF(cell,side,node,qp,jdim);
-          }
+          res_qp += scaling_q*q(cell,side,qp,idim) * metric(cell,side,qp,idim,jdim) * GradBF(cell,side,node,qp,jdim);
         }
-
-        res_node += res_qp * w_measure(cell,side,qp);
       }
 
-      if (use_melting && mass_lumping) {
-        res_node += m(cell,side,node)/rho_w;
-      }
+      res_node += res_qp * w_measure(cell,side,qp);
+    }
 
-      residual (cell,side,node) = res_node;
+    if (use_melting && mass_lumping) {
+      res_node += m(cell,side,node)/rho_w;
     }
+
+    residual (cell,side,node) = res_node;
   }
 }
 
+template<typename EvalT, typename Traits, bool IsStokesCoupling, bool ThermoCoupled>
+void HydrologyResidualMassEqn<EvalT, Traits, IsStokesCoupling, ThermoCoupled>::
+evaluateFieldsSide (typename Traits::EvalData workset)
+{
+  // Zero out, to avoid leaving stuff from previous workset!
+  residual.deep_copy(ScalarT(0.));
+
+  if (sideSetId<0 || (*workset.indexedSideSetViews)[sideSetId].size==0)
+    return;
+
+  sideSet = (*workset.indexedSideSetViews)[sideSetId];
+
+  Kokkos::parallel_for(HydrologyResidualMassEqn_Side_Policy(0, sideSet.size), *this);
+}
+
 template<typename EvalT, typename Traits, bool IsStokesCoupling, bool ThermoCoupled>
 void HydrologyResidualMassEqn<EvalT, Traits, IsStokesCoupling, ThermoCoupled>::
 evaluateFieldsCell (typename Traits::EvalData workset)
@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "Albany_DiscretizationUtils.hpp"
 
 namespace LandIce
 {
@@ -79,6 +80,19 @@ private:
 
   // Variables necessary for stokes coupling
   std::string                     sideSetName;
+
+  Albany::LocalSideSetInfo sideSet;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct HydrologyResidualTillStorageEqn_Side_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,HydrologyResidualTillStorageEqn_Side_Tag> HydrologyResidualTillStorageEqn_Side_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const HydrologyResidualTillStorageEqn_Side_Tag& tag, const int& sideSet_idx) const;
 };
 
 } // Namespace LandIce
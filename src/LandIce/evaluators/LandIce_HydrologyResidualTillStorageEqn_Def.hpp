@@ -6,6 +6,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -139,6 +140,8 @@ template<typename EvalT, typename Traits, bool IsStokesCoupling>
 void HydrologyResidualTillStorageEqn<EvalT, Traits, IsStokesCoupling>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokesCoupling) {
     evaluateFieldsSide(workset);
   } else {
@@ -147,48 +150,55 @@ evaluateFields (typename Traits::EvalData workset)
 }
 
 template<typename EvalT, typename Traits, bool IsStokesCoupling>
+KOKKOS_INLINE_FUNCTION
 void HydrologyResidualTillStorageEqn<EvalT, Traits, IsStokesCoupling>::
-evaluateFieldsSide (typename Traits::EvalData workset)
+operator() (const HydrologyResidualTillStorageEqn_Side_Tag& tag, const int& sideSet_idx) const
 {
-  // Zero out, to avoid leaving stuff from previous workset!
-  residual.deep_copy(ScalarT(0.));
+  ScalarT res_qp, res_node;
 
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
-    return;
+  // Get the local data of side and cell
+  const int cell = sideSet.elem_LID(sideSet_idx);
+  const int side = sideSet.side_local_id(sideSet_idx);
 
-  ScalarT res_qp, res_node, zero(0);
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
-  for (auto const& it_side : sideSet)
+  for (int node=0; node < numNodes; ++node)
   {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
-
-    for (int node=0; node < numNodes; ++node)
+    res_node = 0;
+    for (int qp=0; qp < numQPs; ++qp)
     {
-      res_node = 0;
-      for (int qp=0; qp < numQPs; ++qp)
-      {
-        res_qp = scaling_omega*omega(cell,side,qp) - C_drain - scaling_h_dot*h_till_dot(cell,side,qp);
-
-        if (use_melting && !mass_lumping) {
-          res_qp += m(cell,side,qp)/rho_w;
-        }
+      res_qp = scaling_omega*omega(cell,side,qp) - C_drain - scaling_h_dot*h_till_dot(cell,side,qp);
 
-        res_qp *= BF(cell,side,node,qp);
-
-        res_node += res_qp * w_measure(cell,side,qp);
+      if (use_melting && !mass_lumping) {
+        res_qp += m(cell,side,qp)/rho_w;
       }
 
-      if (use_melting && mass_lumping) {
-        res_node += m(cell,side,node)/rho_w;
-      }
+      res_qp *= BF(cell,side,node,qp);
+
+      res_node += res_qp * w_measure(cell,side,qp);
+    }
 
-      residual (cell,side,node) = res_node;
+    if (use_melting && mass_lumping) {
+      res_node += m(cell,side,node)/rho_w;
     }
+
+    residual (cell,side,node) = res_node;
   }
 }
 
+template<typename EvalT, typename Traits, bool IsStokesCoupling>
+void HydrologyResidualTillStorageEqn<EvalT, Traits, IsStokesCoupling>::
+evaluateFieldsSide (typename Traits::EvalData workset)
+{
+  // Zero out, to avoid leaving stuff from previous workset!
+  residual.deep_copy(ScalarT(0.));
+
+  if (workset.sideSetViews->find(sideSetName)==workset.sideSetViews->end())
+    return;
+
+  sideSet = workset.sideSetViews->at(sideSetName);
+
+  Kokkos::parallel_for(HydrologyResidualTillStorageEqn_Side_Policy(0, sideSet.size), *this);
+}
+
 template<typename EvalT, typename Traits, bool IsStokesCoupling>
 void HydrologyResidualTillStorageEqn<EvalT, Traits, IsStokesCoupling>::
 evaluateFieldsCell (typename Traits::EvalData workset)
@@ -5,6 +5,7 @@
 #include "utility/string.hpp"
 
 #include <math.h>
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -74,6 +75,8 @@ template<typename EvalT, typename Traits, bool OnSide>
 void HydrologySurfaceWaterInput<EvalT,Traits,OnSide>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (OnSide) {
     evaluateFieldsSide(workset);
   } else {
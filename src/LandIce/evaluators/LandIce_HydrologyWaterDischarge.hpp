@@ -69,6 +69,7 @@ private:
   int numQPs;
   int numDim;
   std::string   sideSetName;
+  int           sideSetId;
 
   double k_0;
   double alpha;
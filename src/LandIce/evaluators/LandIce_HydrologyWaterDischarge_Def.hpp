@@ -7,6 +7,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
 #include "Teuchos_VerboseObject.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -96,12 +97,16 @@ postRegistrationSetup(typename Traits::SetupData d,
   }
 
   this->utils.setFieldData(q,fm);
+
+  sideSetId = d.get_side_set_id(sideSetName);
 }
 
 //**********************************************************************
 template<typename EvalT, typename Traits, bool IsStokes>
 void HydrologyWaterDischarge<EvalT, Traits, IsStokes>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (IsStokes) {
     evaluateFieldsSide(workset);
   } else {
@@ -154,7 +159,7 @@ template<typename EvalT, typename Traits, bool IsStokes>
 void HydrologyWaterDischarge<EvalT, Traits, IsStokes>::
 evaluateFieldsSide (typename Traits::EvalData workset)
 {
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end()) {
+  if (sideSetId<0 || (*workset.indexedSideSets)[sideSetId].empty()) {
     return;
   }
 
@@ -174,7 +179,7 @@ evaluateFieldsSide (typename Traits::EvalData workset)
     printedReg = regularization;
   }
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
+  const std::vector<Albany::SideStruct>& sideSet = (*workset.indexedSideSets)[sideSetId];
   for (auto const& it_side : sideSet)
   {
     // Get the local data of side and cell
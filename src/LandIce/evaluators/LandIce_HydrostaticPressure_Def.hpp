@@ -11,6 +11,7 @@
 #include "Phalanx_Print.hpp"
 
 #include "LandIce_HydrostaticPressure.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -70,6 +71,7 @@ template<typename EvalT, typename Traits, typename SurfHeightST>
 void HydrostaticPressure<EvalT,Traits,SurfHeightST>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
 
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
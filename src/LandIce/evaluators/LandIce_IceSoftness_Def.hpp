@@ -8,6 +8,7 @@
 
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -89,6 +90,8 @@ template<typename EvalT, typename Traits, bool ThermoCoupled>
 void IceSoftness<EvalT, Traits, ThermoCoupled>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   switch (ice_softness_type)
   {
     case UNIFORM:
@@ -15,6 +15,7 @@
 #include "Albany_AbstractDiscretization.hpp"
 
 #include "LandIce_L2ProjectedBoundaryLaplacianResidual.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits, typename FieldScalarT>
 LandIce::L2ProjectedBoundaryLaplacianResidualBase<EvalT, Traits, FieldScalarT>::
@@ -110,6 +111,8 @@ postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& f
 template<typename EvalT, typename Traits, typename FieldScalarT>
 void LandIce::L2ProjectedBoundaryLaplacianResidualBase<EvalT, Traits, FieldScalarT>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   TEUCHOS_TEST_FOR_EXCEPTION (workset.sideSets==Teuchos::null, std::logic_error,
                               "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
@@ -11,6 +11,7 @@
 
 #include "LandIce_LaplacianRegularizationResidual.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits>
 LandIce::LaplacianRegularizationResidual<EvalT, Traits>::
@@ -105,6 +106,7 @@ postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& f
 template<typename EvalT, typename Traits>
 void LandIce::LaplacianRegularizationResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
 
   for (int cell=0; cell<numCells; ++cell) {
     MeshScalarT trapezoid_weights = 0;
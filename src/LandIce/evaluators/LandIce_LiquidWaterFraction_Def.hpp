@@ -9,6 +9,7 @@
 #include "Teuchos_VerboseObject.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -69,6 +70,7 @@ template<typename EvalT, typename Traits, typename Type>
 void LiquidWaterFraction<EvalT,Traits,Type>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
   
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
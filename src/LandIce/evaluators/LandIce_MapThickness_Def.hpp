@@ -8,6 +8,7 @@
 #include "Phalanx_Print.hpp"
 
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 #define OUTPUT_TO_SCREEN
@@ -53,6 +54,8 @@ template<typename EvalT, typename Traits>
 void MapThickness<EvalT, Traits>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   PHAL::MDFieldIterator<const MeshScalarT> Hin(H_in);
   PHAL::MDFieldIterator<const MeshScalarT> Hmin(H_min);
   PHAL::MDFieldIterator<const MeshScalarT> Hmax(H_max);
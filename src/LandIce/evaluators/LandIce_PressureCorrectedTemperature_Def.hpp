@@ -9,6 +9,7 @@
 #include "Phalanx_Print.hpp"
 
 #include "LandIce_PressureCorrectedTemperature.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -52,6 +53,8 @@ template<typename EvalT, typename Traits, typename TempST, typename SurfHeightST
 void PressureCorrectedTemperature<EvalT,Traits, TempST, SurfHeightST>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   for (std::size_t cell = 0; cell < workset.numCells; ++cell)
@@ -11,6 +11,7 @@
 #include "Phalanx_Print.hpp"
 
 #include "LandIce_PressureMeltingEnthalpy.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -67,6 +68,8 @@ template<typename EvalT, typename Traits, typename PressST>
 void PressureMeltingEnthalpy<EvalT,Traits,PressST>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
@@ -9,6 +9,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Teuchos_CommHelpers.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits>
 LandIce::ResponseBoundarySquaredL2Norm<EvalT, Traits>::
@@ -94,6 +95,8 @@ void LandIce::ResponseBoundarySquaredL2Norm<EvalT, Traits>::preEvaluate(typename
 template<typename EvalT, typename Traits>
 void LandIce::ResponseBoundarySquaredL2Norm<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   TEUCHOS_TEST_FOR_EXCEPTION (workset.sideSets==Teuchos::null, std::logic_error,
                               "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
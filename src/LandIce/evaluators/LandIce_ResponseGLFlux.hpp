@@ -41,6 +41,7 @@ namespace LandIce {
     Teuchos::RCP<const Teuchos::ParameterList> getValidResponseParameters() const;
 
     std::string basalSideName;
+    int basalSideSetId;
 
     int numSideNodes;
     int numSideDims;
@@ -9,6 +9,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Teuchos_CommHelpers.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits>
 LandIce::ResponseGLFlux<EvalT, Traits>::
@@ -84,6 +85,7 @@ void LandIce::ResponseGLFlux<EvalT, Traits>::postRegistrationSetup(typename Trai
   y = Kokkos::createDynRankView(bed.get_view(), "y", 2);
   velx = Kokkos::createDynRankView(avg_vel.get_view(), "velx", 2);
   vely = Kokkos::createDynRankView(avg_vel.get_view(), "vely", 2);
+  basalSideSetId = d.get_side_set_id(basalSideName);
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
 }
 
@@ -101,16 +103,18 @@ void LandIce::ResponseGLFlux<EvalT, Traits>::preEvaluate(typename Traits::PreEva
 template<typename EvalT, typename Traits>
 void LandIce::ResponseGLFlux<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  if (workset.sideSets == Teuchos::null)
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
+  if (workset.indexedSideSets == Teuchos::null)
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
   // Zero out local response
   PHAL::set(this->local_response_eval, 0.0);
 
-  if (workset.sideSets->find(basalSideName) != workset.sideSets->end())
+  if (basalSideSetId>=0 && !(*workset.indexedSideSets)[basalSideSetId].empty())
   {
     double coeff = rho_i*1e6*scaling; //to convert volume flux [km^2 m yr^{-1}] in a mass flux [kg yr^{-1}]
-    const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(basalSideName);
+    const std::vector<Albany::SideStruct>& sideSet = (*workset.indexedSideSets)[basalSideSetId];
     for (auto const& it_side : sideSet)
     {
       // Get the local data of side and cell
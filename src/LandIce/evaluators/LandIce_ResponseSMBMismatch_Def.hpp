@@ -12,6 +12,7 @@
 #include "PHAL_Utilities.hpp"
 
 #include "LandIce_ResponseSMBMismatch.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits, typename ThicknessScalarType>
 LandIce::ResponseSMBMismatch<EvalT, Traits, ThicknessScalarType>::
@@ -125,6 +126,8 @@ void LandIce::ResponseSMBMismatch<EvalT, Traits, ThicknessScalarType>::preEvalua
 template<typename EvalT, typename Traits, typename ThicknessScalarType>
 void LandIce::ResponseSMBMismatch<EvalT, Traits, ThicknessScalarType>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets == Teuchos::null)
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
@@ -37,6 +37,7 @@ namespace LandIce {
     Teuchos::RCP<const Teuchos::ParameterList> getValidResponseParameters() const;
 
     std::string surfaceSideName;
+    int surfaceSideSetId;
 
     int numSideNodes;
     int numBasalQPs;
@@ -53,6 +54,7 @@ namespace LandIce {
 
     // Stuff for stifferning regularization
     std::string basalSideName;
+    int basalSideSetId;
     PHX::MDField<const ParamScalarT,Cell,Side,QuadPoint,Dim>     grad_stiffening;
     PHX::MDField<const ParamScalarT,Cell,Side,QuadPoint>         stiffening;
     PHX::MDField<const MeshScalarT,Cell,Side,QuadPoint>          w_measure_basal;
@@ -60,6 +62,7 @@ namespace LandIce {
 
     // Stuff for beta regularization
     std::vector<Teuchos::RCP<Teuchos::ParameterList>>                         beta_reg_params;
+    std::vector<int>                                                          betaRegSideSetIds;
     std::vector<PHX::MDField<const ScalarT,Cell,Side,QuadPoint,Dim>>          grad_beta_vec;
     std::vector<PHX::MDField<const MeshScalarT,Cell,Side,QuadPoint>>          w_measure_beta_vec;
     std::vector<PHX::MDField<const MeshScalarT,Cell,Side,QuadPoint,Dim,Dim>>  metric_beta_vec;
@@ -12,6 +12,7 @@
 
 #include "Albany_GeneralPurposeFieldsNames.hpp"
 #include "LandIce_ResponseSurfaceVelocityMismatch.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 template<typename EvalT, typename Traits>
 LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::
@@ -149,6 +150,14 @@ void LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::
 postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& fm)
 {
   PHAL::SeparableScatterScalarResponseWithExtrudedParams<EvalT, Traits>::postRegistrationSetup(d, fm);
+
+  surfaceSideSetId = d.get_side_set_id(surfaceSideName);
+  basalSideSetId   = d.get_side_set_id(basalSideName);
+  betaRegSideSetIds.resize(beta_reg_params.size());
+  for (size_t i=0; i<beta_reg_params.size(); ++i) {
+    betaRegSideSetIds[i] = d.get_side_set_id(beta_reg_params[i]->get<std::string>("Side Set Name",""));
+  }
+
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
 }
 
@@ -168,7 +177,9 @@ void LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::preEvaluate(typena
 template<typename EvalT, typename Traits>
 void LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  TEUCHOS_TEST_FOR_EXCEPTION (workset.sideSets==Teuchos::null, std::logic_error,
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
+  TEUCHOS_TEST_FOR_EXCEPTION (workset.indexedSideSets==Teuchos::null, std::logic_error,
                               "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
   // Zero out local response
@@ -176,9 +187,9 @@ void LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::evaluateFields(typ
 
   // ----------------- Surface side ---------------- //
 
-  if (workset.sideSets->find(surfaceSideName) != workset.sideSets->end())
+  if (surfaceSideSetId>=0 && !(*workset.indexedSideSets)[surfaceSideSetId].empty())
   {
-    const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(surfaceSideName);
+    const std::vector<Albany::SideStruct>& sideSet = (*workset.indexedSideSets)[surfaceSideSetId];
     for (auto const& it_side : sideSet)
     {
       // Get the local data of side and cell
@@ -230,14 +241,13 @@ void LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::evaluateFields(typ
 
   if (alpha!=0) {
     for (size_t i=0; i<beta_reg_params.size(); ++i) {
-      Teuchos::RCP<Teuchos::ParameterList> pl = beta_reg_params[i];
-      std::string ssName = pl->get<std::string>("Side Set Name","");
+      const int ssId = betaRegSideSetIds[i];
 
       auto grad_beta = grad_beta_vec[i];
       auto metric = metric_beta_vec[i];
       auto w_measure = w_measure_beta_vec[i];
-      if (workset.sideSets->find(ssName) != workset.sideSets->end()) {
-        const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(ssName);
+      if (ssId>=0 && !(*workset.indexedSideSets)[ssId].empty()) {
+        const std::vector<Albany::SideStruct>& sideSet = (*workset.indexedSideSets)[ssId];
         for (auto const& it_side : sideSet)
         {
           // Get the local data of side and cell
@@ -261,9 +271,9 @@ void LandIce::ResponseSurfaceVelocityMismatch<EvalT, Traits>::evaluateFields(typ
     }
   }
 
-  if (workset.sideSets->find(basalSideName) != workset.sideSets->end() && alpha_stiffening!=0)
+  if (basalSideSetId>=0 && !(*workset.indexedSideSets)[basalSideSetId].empty() && alpha_stiffening!=0)
   {
-    const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(basalSideName);
+    const std::vector<Albany::SideStruct>& sideSet = (*workset.indexedSideSets)[basalSideSetId];
     for (auto const& it_side : sideSet)
     {
       // Get the local data of side and cell
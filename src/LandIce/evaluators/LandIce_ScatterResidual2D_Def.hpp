@@ -13,6 +13,7 @@
 #include "Albany_GlobalLocalIndexer.hpp"
 
 #include "LandIce_ScatterResidual2D.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -49,6 +50,8 @@ template<typename Traits>
 void ScatterResidual2D<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   const bool loadResid = Teuchos::nonnull(workset.f);
   Teuchos::Array<LO> lcols;
@@ -211,6 +214,8 @@ template<typename Traits>
 void ScatterResidualWithExtrudedField<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   const bool loadResid = Teuchos::nonnull(workset.f);
   const int neq = nodeID.extent(2);
@@ -8,6 +8,7 @@
 #include "Phalanx_Print.hpp"
 
 #include "PHAL_Utilities.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -57,6 +58,8 @@ template<typename EvalT, typename Traits, typename InOutScalarT, template<typena
 void SimpleUnaryOperation<EvalT, Traits, InOutScalarT, UnaryOperation>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   PHAL::MDFieldIterator<const InOutScalarT> in(this->field_in);
   PHAL::MDFieldIterator<InOutScalarT> out(this->field_out);
   for (; !in.done(); ++in, ++out) {
@@ -128,6 +131,8 @@ template<typename EvalT, typename Traits, typename InOutScalarT, typename FieldS
 void SimpleBinaryOperation<EvalT, Traits, InOutScalarT, FieldScalarT, BinaryOperation>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   PHAL::MDFieldIterator<const InOutScalarT> in(this->field_in);
   PHAL::MDFieldIterator<const FieldScalarT> param1(field1);
   PHAL::MDFieldIterator<InOutScalarT> out(this->field_out);
@@ -216,6 +221,8 @@ template<typename EvalT, typename Traits, typename InOutScalarT, typename FieldS
 void SimpleTernaryOperation<EvalT, Traits, InOutScalarT, FieldScalarT, TernaryOperation>::
 evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   PHAL::MDFieldIterator<const InOutScalarT> in(this->field_in);
   PHAL::MDFieldIterator<const FieldScalarT> param1(field1);
   PHAL::MDFieldIterator<const FieldScalarT> param2(field2);
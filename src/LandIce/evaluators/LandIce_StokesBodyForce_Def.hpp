@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
 #include "Sacado.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 
 namespace LandIce {
@@ -406,6 +407,8 @@ template<typename EvalT, typename Traits>
 void StokesBodyForce<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
  if (bf_type == NONE) {
    for (std::size_t cell=0; cell < workset.numCells; ++cell)
      for (std::size_t qp=0; qp < numQPs; ++qp)
@@ -7,6 +7,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -57,6 +58,7 @@ template<typename EvalT, typename Traits>
 void StokesContravarientMetricTensor<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
 
   /** The allocated size of the Field Containers must currently
     * match the full workset size of the allocated PHX Fields,
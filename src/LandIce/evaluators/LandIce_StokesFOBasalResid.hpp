@@ -14,6 +14,7 @@
 
 #include "Albany_Layouts.hpp"
 #include "Albany_ScalarOrdinalTypes.hpp"
+#include "Albany_DiscretizationUtils.hpp"
 #include "PHAL_Dimension.hpp"
 
 namespace LandIce
@@ -57,8 +58,8 @@ private:
   // Output:
   PHX::MDField<ScalarT,Cell,Node,VecDim>            residual;
 
-  std::vector<std::vector<int> >  sideNodes;
-  std::string                     basalSideName;
+  Kokkos::View<int**, PHX::Device> sideNodes;
+  std::string                      basalSideName;
 
   int numSideNodes;
   int numSideQPs;
@@ -67,6 +68,21 @@ private:
   int vecDimFO;
 
   bool regularized;
+
+  ScalarT ff;
+
+  Albany::LocalSideSetInfo sideSet;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct StokesFOBasalResid_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,StokesFOBasalResid_Tag> StokesFOBasalResid_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const StokesFOBasalResid_Tag& tag, const int& sideSet_idx) const;
 };
 
 } // Namespace LandIce
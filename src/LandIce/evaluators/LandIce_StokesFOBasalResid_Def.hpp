@@ -10,6 +10,7 @@
 
 #include "Albany_DiscretizationUtils.hpp"
 #include "LandIce_StokesFOBasalResid.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 // #define OUTPUT_TO_SCREEN
@@ -66,18 +67,22 @@ StokesFOBasalResid<EvalT, Traits, BetaScalarT>::StokesFOBasalResid (const Teucho
   // Index of the nodes on the sides in the numeration of the cell
   Teuchos::RCP<shards::CellTopology> cellType;
   cellType = p.get<Teuchos::RCP <shards::CellTopology> > ("Cell Type");
-  sideNodes.resize(numSides);
   sideDim = cellType->getDimension()-1;
-  for (int side=0; side<numSides; ++side)
-  {
+  int nodeMax = 0;
+  for (int side=0; side<numSides; ++side) {
     // Need to get the subcell exact count, since different sides may have different number of nodes (e.g., Wedge)
     int thisSideNodes = cellType->getNodeCount(sideDim,side);
-    sideNodes[side].resize(thisSideNodes);
-    for (int node=0; node<thisSideNodes; ++node)
-    {
-      sideNodes[side][node] = cellType->getNodeMap(sideDim,side,node);
+    nodeMax = std::max(nodeMax, thisSideNodes);
+  }
+  sideNodes = Kokkos::View<int**, PHX::Device>("sideNodes", numSides, nodeMax);
+  auto sideNodes_h = Kokkos::create_mirror_view(sideNodes);
+  for (int side=0; side<numSides; ++side) {
+    int thisSideNodes = cellType->getNodeCount(sideDim,side);
+    for (int node=0; node<thisSideNodes; ++node) {
+      sideNodes_h(side,node) = cellType->getNodeMap(sideDim,side,node);
     }
   }
+  Kokkos::deep_copy(sideNodes, sideNodes_h);
 
   printedFF = -1.0;
   this->setName("StokesFOBasalResid"+PHX::print<EvalT>());
@@ -100,11 +105,38 @@ postRegistrationSetup(typename Traits::SetupData d,
   d.fill_field_dependencies(this->dependentFields(),this->contributedFields());
 }
 
+//**********************************************************************
+// Kokkos functor
+template<typename EvalT, typename Traits, typename BetaScalarT>
+KOKKOS_INLINE_FUNCTION
+void StokesFOBasalResid<EvalT, Traits, BetaScalarT>::
+operator() (const StokesFOBasalResid_Tag& tag, const int& sideSet_idx) const {
+
+  // Get the local data of side and cell
+  const int cell = sideSet.elem_LID(sideSet_idx);
+  const int side = sideSet.side_local_id(sideSet_idx);
+
+  // Note: a cell has at most one side on the basal side set, so different
+  //       threads never contribute to the same residual entry.
+  for (int node=0; node<numSideNodes; ++node) {
+    const int cnode = sideNodes(side,node);
+    for (int dim=0; dim<vecDimFO; ++dim) {
+      ScalarT res = 0;
+      for (int qp=0; qp<numSideQPs; ++qp) {
+        res += (ff + beta(cell,side,qp)*u(cell,side,qp,dim))*BF(cell,side,node,qp)*w_measure(cell,side,qp);
+      }
+      residual(cell,cnode,dim) += res;
+    }
+  }
+}
+
 //**********************************************************************
 template<typename EvalT, typename Traits, typename BetaScalarT>
 void StokesFOBasalResid<EvalT, Traits, BetaScalarT>::evaluateFields (typename Traits::EvalData workset)
 {
-  ScalarT ff = (regularized) ? pow(10.0, -10.0*homotopyParam(0)) : ScalarT(0);
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
+  ff = (regularized) ? pow(10.0, -10.0*homotopyParam(0)) : ScalarT(0);
 #ifdef OUTPUT_TO_SCREEN
   Teuchos::RCP<Teuchos::FancyOStream> output(Teuchos::VerboseObjectBase::getDefaultOStream());
 
@@ -114,27 +146,13 @@ void StokesFOBasalResid<EvalT, Traits, BetaScalarT>::evaluateFields (typename Tr
   }
 #endif
 
-  if (workset.sideSets->find(basalSideName)==workset.sideSets->end()) {
+  if (workset.sideSetViews->find(basalSideName)==workset.sideSetViews->end()) {
     return;
   }
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(basalSideName);
+  sideSet = workset.sideSetViews->at(basalSideName);
 
-  for (auto const& it_side : sideSet) {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
-
-    for (int node=0; node<numSideNodes; ++node) {
-      std::vector<ScalarT> res(2,0.0);
-      for (int dim=0; dim<vecDimFO; ++dim) {
-        for (int qp=0; qp<numSideQPs; ++qp) {
-          res[dim] += (ff + beta(cell,side,qp)*u(cell,side,qp,dim))*BF(cell,side,node,qp)*w_measure(cell,side,qp);
-          residual(cell,sideNodes[side][node],dim) += (ff + beta(cell,side,qp)*u(cell,side,qp,dim))*BF(cell,side,node,qp)*w_measure(cell,side,qp);
-        }
-      }
-    }
-  }
+  Kokkos::parallel_for(StokesFOBasalResid_Policy(0, sideSet.size), *this);
 }
 
 } // Namespace LandIce
@@ -11,6 +11,7 @@
 #include "Sacado.hpp"
 
 #include "LandIce_StokesFOBodyForce.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -450,6 +451,8 @@ template<typename EvalT, typename Traits>
 void StokesFOBodyForce<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   rho_g_kernel=rho_g;
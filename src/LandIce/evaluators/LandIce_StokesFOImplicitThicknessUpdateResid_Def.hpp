@@ -11,6 +11,8 @@
 #include "PHAL_Utilities.hpp"
 
 #include "LandIce_StokesFOImplicitThicknessUpdateResid.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
+#include "PHAL_ScratchArena.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -68,8 +70,6 @@ postRegistrationSetup(typename Traits::SetupData /* d */,
   this->utils.setFieldData(wBF,fm);
   this->utils.setFieldData(gradBF,fm);
   this->utils.setFieldData(Residual,fm);
-
-  Res = createDynRankView(Residual.get_view(), "Residual", numCells, numNodes,2);
 }
 //**********************************************************************
 //Kokkos functors
@@ -106,6 +106,11 @@ template<typename EvalT, typename Traits>
 void StokesFOImplicitThicknessUpdateResid<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
+  // Only needed during this evaluation: share the memory with other evaluators
+  Res = PHAL::createScratchView<Kokkos::DynRankView<ScalarT, PHX::Device>>(workset, Residual.get_view(), "Residual", workset.numCells, numNodes, 2);
+
   Kokkos::parallel_for(StokesFOImplicitThicknessUpdateResid_Policy(0,workset.numCells),*this);
 }
 
@@ -10,6 +10,7 @@
 
 #include "Albany_DiscretizationUtils.hpp"
 #include "LandIce_StokesFOLateralResid.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -129,6 +130,8 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename EvalT, typename Traits, typename ThicknessScalarT>
 void StokesFOLateralResid<EvalT, Traits, ThicknessScalarT>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(lateralSideName)==workset.sideSets->end()) {
     return;
   }
@@ -13,6 +13,7 @@
 #include "Albany_GeneralPurposeFieldsNames.hpp"
 
 #include "LandIce_StokesFOSynteticTestBC.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 #include <string.hpp> // For util::upper_case (do not confuse this with <string>! string.hpp is an Albany file)
 
@@ -160,6 +161,8 @@ postRegistrationSetup(typename Traits::SetupData /* d */,
 template<typename EvalT, typename Traits, typename betaScalarT>
 void StokesFOSynteticTestBC<EvalT, Traits, betaScalarT>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(ssName)==workset.sideSets->end()) {
     return;
   }
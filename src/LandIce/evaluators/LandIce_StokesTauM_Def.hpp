@@ -7,6 +7,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -55,9 +56,6 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(jacobian_det,fm);
 
   this->utils.setFieldData(TauM,fm);
-
-  // Allocate workspace
-  normGc = Kokkos::createDynRankView(Gc.get_view(), "XXX", numCells, numQPs);
 }
 
 //**********************************************************************
@@ -65,6 +63,8 @@ template<typename EvalT, typename Traits>
 void StokesTauM<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   //tau = h^2*delta - stabilization from Bochev et. al. "taxonomy" paper
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < numQPs; ++qp) {
@@ -10,6 +10,7 @@
 #include "PHAL_Utilities.hpp"
 
 #include "LandIce_SurfaceAirEnthalpy.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -52,6 +53,8 @@ template<typename EvalT, typename Traits, typename SurfTempST>
 void SurfaceAirEnthalpy<EvalT,Traits,SurfTempST>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   const double powm6 = 1e-6; // [k^2], k=1000
@@ -15,6 +15,7 @@
 #include "Albany_AbstractDiscretization.hpp"
 
 #include "LandIce_Temperature.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -121,6 +122,8 @@ template<typename EvalT, typename Traits, typename TemperatureST>
 void Temperature<EvalT,Traits,TemperatureST>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
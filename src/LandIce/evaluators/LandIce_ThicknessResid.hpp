@@ -16,6 +16,7 @@
 
 #include "PHAL_Dimension.hpp"
 #include "Albany_Layouts.hpp"
+#include "Albany_DiscretizationUtils.hpp"
 #include "Albany_ScalarOrdinalTypes.hpp"
 
 namespace LandIce {
@@ -57,26 +58,56 @@ private:
   PHX::MDField<ScalarT,Cell,Node> Residual;
 
 
-  int  cellDims, numNodes, cubatureDegree;
+  int  cellDims, numNodes, numCells, cubatureDegree;
   Teuchos::RCP<double> dt;
   bool have_SMB;
   std::string sideSetName;
+  int sideSetId;
 
   std::size_t numVecFODims;
 
 
   Teuchos::RCP<shards::CellTopology> cellType;
-  Teuchos::RCP<shards::CellTopology> sideType;
-  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubatureSide;
 
   // The basis
   Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis;
 
-  // Temporary Views
+  // Reference element quantities for each side of the cell, computed once
+  int numSidesOnElem, maxNumQpSide, maxNumSideNodes;
+  std::vector<int> sideDims, numQPsSide;
+  std::vector<Kokkos::DynRankView<RealType, PHX::Device> > cubWeightsSide;
+  std::vector<Kokkos::DynRankView<RealType, PHX::Device> > refPointsSide;
+  std::vector<Kokkos::DynRankView<RealType, PHX::Device> > basis_refPointsSide;
+  std::vector<Kokkos::DynRankView<RealType, PHX::Device> > basisGrad_refPointsSide;
+  Kokkos::View<int*, PHX::Device>  numSideNodes;
+  Kokkos::View<int**, PHX::Device> sideNodes;
+
+  // Views on the scratch buffers (see evaluateFields), for the cells sharing
+  // the local side currently processed
   Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsCell;
+  Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_gradBasis_refPointsSide;
+  Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide;
+  Kokkos::DynRankView<RealType, PHX::Device>    basisSide;
 
-  std::string sideSetID;
+  Albany::LocalSideSetInfo sideSet;
+  int side, numQPs;
+  double dtValue;
 
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct ThicknessResid_Coords_Tag{};
+  struct ThicknessResid_Side_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,ThicknessResid_Coords_Tag> ThicknessResid_Coords_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace,ThicknessResid_Side_Tag> ThicknessResid_Side_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ThicknessResid_Coords_Tag& tag, const int& iCell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ThicknessResid_Side_Tag& tag, const int& iCell) const;
 };
 
 } // namespace LandIce
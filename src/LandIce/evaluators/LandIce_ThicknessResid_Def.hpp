@@ -16,6 +16,8 @@
 #include "Albany_ProblemUtils.hpp"
 #include "Albany_DiscretizationUtils.hpp"
 #include "LandIce_ThicknessResid.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
+#include "PHAL_ScratchArena.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -61,6 +63,7 @@ ThicknessResid(const Teuchos::ParameterList& p,
 
   std::vector<PHX::DataLayout::size_type> dims;
   dl->node_vector->dimensions(dims);
+  numCells = dims[0];
   numNodes = dims[1];
   numVecFODims  = std::min(dims[2], PHX::DataLayout::size_type(2));
 
@@ -86,205 +89,202 @@ ThicknessResid(const Teuchos::ParameterList& p,
 //**********************************************************************
 template<typename EvalT, typename Traits>
 void ThicknessResid<EvalT, Traits>::
-postRegistrationSetup(typename Traits::SetupData /* d */,
+postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& /* fm */)
 {
-  physPointsCell = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numNodes, cellDims);
+  sideSetId = d.get_side_set_id(sideSetName);
+
+  // The reference element quantities only depend on the local side, so
+  // compute them here, rather than at every evaluation
+  const CellTopologyData * const elem_top = cellType->getCellTopologyData();
+  numSidesOnElem = elem_top->side_count;
+  sideDims.resize(numSidesOnElem);
+  numQPsSide.resize(numSidesOnElem);
+  cubWeightsSide.resize(numSidesOnElem);
+  refPointsSide.resize(numSidesOnElem);
+  basis_refPointsSide.resize(numSidesOnElem);
+  basisGrad_refPointsSide.resize(numSidesOnElem);
+
+  Intrepid2::DefaultCubatureFactory cubFactory;
+  maxNumQpSide = maxNumSideNodes = 0;
+  for (int iSide=0; iSide<numSidesOnElem; ++iSide) {
+    shards::CellTopology sideType(elem_top->side[iSide].topology);
+    auto cubatureSide = cubFactory.create<PHX::Device, RealType, RealType>(sideType, cubatureDegree);
+    sideDims[iSide] = sideType.getDimension();
+    numQPsSide[iSide] = cubatureSide->getNumPoints();
+    maxNumQpSide = std::max(maxNumQpSide, numQPsSide[iSide]);
+    maxNumSideNodes = std::max(maxNumSideNodes, static_cast<int>(sideType.getNodeCount()));
+
+    Kokkos::DynRankView<RealType, PHX::Device> cubPointsSide("cubPointsSide", numQPsSide[iSide], sideDims[iSide]);
+    cubWeightsSide[iSide] = Kokkos::DynRankView<RealType, PHX::Device>("cubWeightsSide", numQPsSide[iSide]);
+    refPointsSide[iSide] = Kokkos::DynRankView<RealType, PHX::Device>("refPointsSide", numQPsSide[iSide], cellDims);
+    basis_refPointsSide[iSide] = Kokkos::DynRankView<RealType, PHX::Device>("basis_refPointsSide", numNodes, numQPsSide[iSide]);
+    basisGrad_refPointsSide[iSide] = Kokkos::DynRankView<RealType, PHX::Device>("basisGrad_refPointsSide", numNodes, numQPsSide[iSide], cellDims);
+
+    cubatureSide->getCubature(cubPointsSide, cubWeightsSide[iSide]);
+
+    // Map side cubature points to the reference parent cell based on the appropriate side
+    Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell(refPointsSide[iSide], cubPointsSide, sideDims[iSide], iSide, *cellType);
+
+    // Values of the basis functions at side cubature points, in the reference parent cell domain
+    intrepidBasis->getValues(basis_refPointsSide[iSide], refPointsSide[iSide], Intrepid2::OPERATOR_VALUE);
+    intrepidBasis->getValues(basisGrad_refPointsSide[iSide], refPointsSide[iSide], Intrepid2::OPERATOR_GRAD);
+  }
+
+  numSideNodes = Kokkos::View<int*, PHX::Device>("numSideNodes", numSidesOnElem);
+  sideNodes = Kokkos::View<int**, PHX::Device>("sideNodes", numSidesOnElem, maxNumSideNodes);
+  auto numSideNodes_h = Kokkos::create_mirror_view(numSideNodes);
+  auto sideNodes_h = Kokkos::create_mirror_view(sideNodes);
+  for (int iSide=0; iSide<numSidesOnElem; ++iSide) {
+    const CellTopologyData_Subcell& sideData = elem_top->side[iSide];
+    numSideNodes_h(iSide) = sideData.topology->node_count;
+    for (int i=0; i<numSideNodes_h(iSide); ++i) {
+      sideNodes_h(iSide,i) = sideData.node[i];
+    }
+  }
+  Kokkos::deep_copy(numSideNodes, numSideNodes_h);
+  Kokkos::deep_copy(sideNodes, sideNodes_h);
 }
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void ThicknessResid<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const ThicknessResid_Coords_Tag& /* tag */, const int& iCell) const
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
+  const int cell = sideSet.cellsOnSide(side,iCell);
 
-  // Initialize residual to 0.0
-  Kokkos::deep_copy(Residual.get_view(), ScalarT(0.0));
-
-  const Albany::SideSetList& ssList = *(workset.sideSets);
-  Albany::SideSetList::const_iterator it_ss = ssList.find(sideSetName);
-
-  if (it_ss != ssList.end()) {
-    const std::vector<Albany::SideStruct>& sideSet = it_ss->second;
-
-    Kokkos::DynRankView<RealType, PHX::Device> cubPointsSide;
-    Kokkos::DynRankView<RealType, PHX::Device> refPointsSide;
-    Kokkos::DynRankView<RealType, PHX::Device> cubWeightsSide;
-    Kokkos::DynRankView<RealType, PHX::Device> basis_refPointsSide;
-    Kokkos::DynRankView<RealType, PHX::Device> basisGrad_refPointsSide;
-
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> invJacobianSide;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide_det;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_measure;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_gradBasis_refPointsSide;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide;
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> scratch;
-
-    Kokkos::DynRankView<ScalarT, PHX::Device> dofSide;
-    Kokkos::DynRankView<ScalarT, PHX::Device> dofSideVec;
-    Kokkos::DynRankView<ScalarT, PHX::Device> dH_Side;
-    Kokkos::DynRankView<ScalarT, PHX::Device> SMB_Side;
-    Kokkos::DynRankView<ScalarT, PHX::Device> H0_Side;
-    Kokkos::DynRankView<ScalarT, PHX::Device> V_Side;
-
-    Kokkos::DynRankView<ScalarT, PHX::Device> dH_Cell;
-    Kokkos::DynRankView<ScalarT, PHX::Device> SMB_Cell;
-    Kokkos::DynRankView<ScalarT, PHX::Device> H0_Cell;
-    Kokkos::DynRankView<ScalarT, PHX::Device> V_Cell;
-    Kokkos::DynRankView<ScalarT, PHX::Device> gradH_Side;
-    Kokkos::DynRankView<ScalarT, PHX::Device> divV_Side;
-
-    // Loop over the sides that form the boundary condition
-    for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
-
-      // Get the data that corresponds to the side
-      const int elem_LID = sideSet[iSide].elem_LID;
-      const int elem_side = sideSet[iSide].side_local_id;
-
-      const CellTopologyData_Subcell& side =  cellType->getCellTopologyData()->side[elem_side];
-      sideType = Teuchos::rcp(new shards::CellTopology(side.topology));
-      int numSideNodes = sideType->getNodeCount();
-      Intrepid2::DefaultCubatureFactory cubFactory;
-      cubatureSide = cubFactory.create<PHX::Device, RealType, RealType>(*sideType, cubatureDegree);
-      int sideDims = sideType->getDimension();
-      int numQPsSide = cubatureSide->getNumPoints();
-
-      // Allocate Temporary Views
-      cubPointsSide = Kokkos::DynRankView<RealType, PHX::Device>("XXX", numQPsSide, sideDims);
-      refPointsSide = Kokkos::DynRankView<RealType, PHX::Device>("XXX", numQPsSide, cellDims);
-      cubWeightsSide = Kokkos::DynRankView<RealType, PHX::Device>("XXX", numQPsSide);
-      basis_refPointsSide = Kokkos::DynRankView<RealType, PHX::Device>("XXX", numNodes, numQPsSide);
-      basisGrad_refPointsSide = Kokkos::DynRankView<RealType, PHX::Device>("XXX", numNodes, numQPsSide, cellDims);
-
-      jacobianSide = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numQPsSide, cellDims, cellDims);
-      invJacobianSide = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numQPsSide, cellDims, cellDims);
-      jacobianSide_det = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numQPsSide);
-      weighted_measure = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numQPsSide);
-      trans_basis_refPointsSide = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numNodes, numQPsSide);
-      trans_gradBasis_refPointsSide = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numNodes, numQPsSide, cellDims);
-      weighted_trans_basis_refPointsSide = Kokkos::createDynRankView(coordVec.get_view(), "XXX", 1, numNodes, numQPsSide);
-      scratch = Kokkos::createDynRankView(jacobianSide,"XXS", numQPsSide*cellDims*cellDims);
-
-      dofSide = Kokkos::createDynRankView(Residual.get_view(), "XXX", 1, numQPsSide);
-      dofSideVec = Kokkos::createDynRankView(Residual.get_view(), "XXX", 1, numQPsSide, numVecFODims);
-      dH_Side = Kokkos::createDynRankView(Residual.get_view(), "XXX", numQPsSide);
-      SMB_Side = Kokkos::createDynRankView(Residual.get_view(), "XXX", numQPsSide);
-      H0_Side = Kokkos::createDynRankView(Residual.get_view(), "XXX", numQPsSide);
-      V_Side = Kokkos::createDynRankView(Residual.get_view(), "XXX", numQPsSide, numVecFODims);
-
-      // Pre-Calculate reference element quantitites
-      cubatureSide->getCubature(cubPointsSide, cubWeightsSide);
-
-      // Copy the coordinate data over to a temp container
-     for (std::size_t node = 0; node < numNodes; ++node) {
-       for (std::size_t dim = 0; dim < cellDims; ++dim)
-         physPointsCell(0, node, dim) = coordVec(elem_LID, node, dim);
-       physPointsCell(0, node, cellDims-1) = -1.0; //set z=-1 on internal cell nodes and z=0 side (see next lines).
-     }
-     for (int i = 0; i < numSideNodes; ++i)
-       physPointsCell(0, side.node[i], cellDims-1) = 0.0;  //set z=0 on side
-
-      // Map side cubature points to the reference parent cell based on the appropriate side (elem_side)
-      Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell(refPointsSide, cubPointsSide, sideDims, elem_side, *cellType);
-
-      // Calculate side geometry
-      Intrepid2::CellTools<PHX::Device>::setJacobian(jacobianSide, refPointsSide, physPointsCell, *cellType);
-
-      Intrepid2::CellTools<PHX::Device>::setJacobianInv(invJacobianSide, jacobianSide);
-
-      Intrepid2::CellTools<PHX::Device>::setJacobianDet(jacobianSide_det, jacobianSide);
-
-      if (sideDims < 2) { //for 1 and 2D, get weighted edge measure
-        FST::computeEdgeMeasure(weighted_measure, jacobianSide, cubWeightsSide, elem_side, *cellType, scratch);
-      } else { //for 3D, get weighted face measure
-        FST::computeFaceMeasure(weighted_measure, jacobianSide, cubWeightsSide, elem_side, *cellType, scratch);
-      }
+  // Copy the coordinate data over to a temp container
+  for (int node = 0; node < numNodes; ++node) {
+    for (int dim = 0; dim < cellDims; ++dim)
+      physPointsCell(iCell, node, dim) = coordVec(cell, node, dim);
+    physPointsCell(iCell, node, cellDims-1) = -1.0; //set z=-1 on internal cell nodes and z=0 side (see next lines).
+  }
+  for (int i = 0; i < numSideNodes(side); ++i)
+    physPointsCell(iCell, sideNodes(side,i), cellDims-1) = 0.0;  //set z=0 on side
+}
 
-      // Values of the basis functions at side cubature points, in the reference parent cell domain
-      intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ThicknessResid<EvalT, Traits>::
+operator() (const ThicknessResid_Side_Tag& /* tag */, const int& iCell) const
+{
+  const int cell = sideSet.cellsOnSide(side,iCell);
+  const int numNodesSide = numSideNodes(side);
+
+  for (int i = 0; i < numNodesSide; ++i)
+    Residual(cell, sideNodes(side,i)) = 0.0;
+
+  ScalarT V_qp[2], gradH_qp[2];
+  for (int qp = 0; qp < numQPs; ++qp) {
+    ScalarT dH_qp(0.0), H0_qp(0.0), SMB_qp(0.0), divV_qp(0.0);
+    for (std::size_t dim = 0; dim < numVecFODims; ++dim) {
+      V_qp[dim] = 0.0;
+      gradH_qp[dim] = 0.0;
+    }
 
-      intrepidBasis->getValues(basisGrad_refPointsSide, refPointsSide, Intrepid2::OPERATOR_GRAD);
+    // Get dof at cubature points of appropriate side (see DOFVecInterpolation evaluator)
+    for (int i = 0; i < numNodesSide; ++i) {
+      const int node = sideNodes(side,i);
+      const RealType tmp = basisSide(node, qp);
+      dH_qp += dH(cell, node) * tmp;
+      if (have_SMB)
+        SMB_qp += SMB(cell, node) * tmp;
+      H0_qp += H0(cell, node) * tmp;
+      for (std::size_t dim = 0; dim < numVecFODims; ++dim)
+        V_qp[dim] += V(cell, side, i, dim) * tmp;
+    }
 
-      // Transform values of the basis functions
-      FST::HGRADtransformVALUE(trans_basis_refPointsSide, basis_refPointsSide);
+    for (int i = 0; i < numNodesSide; ++i) {
+      const int node = sideNodes(side,i);
+      for (std::size_t dim = 0; dim < numVecFODims; ++dim) {
+        const MeshScalarT& tmp = trans_gradBasis_refPointsSide(iCell, node, qp, dim);
+        gradH_qp[dim] += H0(cell, node) * tmp;
+        divV_qp += V(cell, side, i, dim) * tmp;
+      }
+    }
 
-      FST::HGRADtransformGRAD(trans_gradBasis_refPointsSide, invJacobianSide, basisGrad_refPointsSide);
+    ScalarT divHV = divV_qp * H0_qp;
+    for (std::size_t dim = 0; dim < numVecFODims; ++dim)
+      divHV += gradH_qp[dim] * V_qp[dim];
 
-      // Multiply with weighted measure
-      FST::multiplyMeasure(weighted_trans_basis_refPointsSide, weighted_measure, trans_basis_refPointsSide);
+    const ScalarT tmp = dH_qp + (dtValue/1000.0) * divHV - dtValue*SMB_qp;
+    for (int i = 0; i < numNodesSide; ++i) {
+      const int node = sideNodes(side,i);
+      Residual(cell, node) += tmp * weighted_trans_basis_refPointsSide(iCell, node, qp);
+    }
+  }
+}
 
-      // Map cell (reference) degree of freedom points to the appropriate side (elem_side)
-      dH_Cell = createDynRankView(Residual.get_view(), "xxx", numNodes);
-      SMB_Cell = createDynRankView(Residual.get_view(), "xxx", numNodes);
-      H0_Cell = createDynRankView(Residual.get_view(), "xxx", numNodes);
-      V_Cell = createDynRankView(Residual.get_view(), "xxx", numNodes, numVecFODims);
-      gradH_Side = createDynRankView(Residual.get_view(), "xxx", numQPsSide, numVecFODims);
-      divV_Side = createDynRankView(Residual.get_view(), "xxx", numQPsSide);
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ThicknessResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
 
-      std::map<LO, std::size_t>::const_iterator it;
+  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
+  typedef Intrepid2::CellTools<PHX::Device> ICT;
+  using DynRankViewMeshScalarT = Kokkos::DynRankView<MeshScalarT, PHX::Device>;
 
-      for (int i = 0; i < numSideNodes; ++i){
-        std::size_t node = side.node[i];
-        dH_Cell(node) = dH(elem_LID, node);
-        H0_Cell(node) = H0(elem_LID, node);
-        SMB_Cell(node) = have_SMB ? SMB(elem_LID, node) : ScalarT(0.0);
-        for (std::size_t dim = 0; dim < numVecFODims; ++dim)
-          V_Cell(node, dim) = V(elem_LID, elem_side, i, dim);
-      }
+  // Initialize residual to 0.0
+  Kokkos::deep_copy(Residual.get_view(), ScalarT(0.0));
 
-      // This is needed, since evaluate currently sums into
-      for (int qp = 0; qp < numQPsSide; qp++) {
-        dH_Side(qp) = 0.0;
-        H0_Side(qp) = 0.0;
-        SMB_Side(qp) = 0.0;
-        divV_Side(qp) = 0.0;
-        for (std::size_t dim = 0; dim < numVecFODims; ++dim) {
-          V_Side(qp, dim) = 0.0;
-          gradH_Side(qp, dim) = 0.0;
-        }
-      }
+  if (sideSetId<0 || (*workset.indexedSideSetViews)[sideSetId].size==0)
+    return;
+
+  sideSet = (*workset.indexedSideSetViews)[sideSetId];
+  dtValue = *dt;
+
+  // Temporary buffers from the workset scratch arena, large enough for all the
+  // cells of the workset, and shared by all the local sides
+  const int numCellsWs = workset.numCells;
+  const auto coords = coordVec.get_view();
+  DynRankViewMeshScalarT physPointsCell_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "physPointsCell", numCellsWs*numNodes*cellDims);
+  DynRankViewMeshScalarT jacobianSide_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "jacobianSide", numCellsWs*maxNumQpSide*cellDims*cellDims);
+  DynRankViewMeshScalarT invJacobianSide_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "invJacobianSide", numCellsWs*maxNumQpSide*cellDims*cellDims);
+  DynRankViewMeshScalarT weighted_measure_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "weighted_measure", numCellsWs*maxNumQpSide);
+  DynRankViewMeshScalarT trans_gradBasis_refPointsSide_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "trans_gradBasis_refPointsSide", numCellsWs*numNodes*maxNumQpSide*cellDims);
+  DynRankViewMeshScalarT weighted_trans_basis_refPointsSide_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "weighted_trans_basis_refPointsSide", numCellsWs*numNodes*maxNumQpSide);
+  DynRankViewMeshScalarT temporary_buffer = PHAL::createScratchView<DynRankViewMeshScalarT>(workset, coords, "temporary_buffer", numCellsWs*maxNumQpSide*cellDims*cellDims);
+
+  // Cells with the same local side share the reference quantities, so process them together
+  for (int iSide = 0; iSide < sideSet.numSides; ++iSide) {
+    const int numCells_ = sideSet.numCellsOnSide(iSide);
+    if (numCells_ == 0) continue;
+
+    side = iSide;
+    numQPs = numQPsSide[side];
+    basisSide = basis_refPointsSide[side];
+
+    physPointsCell = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
+    DynRankViewMeshScalarT jacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPs, cellDims, cellDims);
+    DynRankViewMeshScalarT invJacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(invJacobianSide_buffer, invJacobianSide_buffer.data(), numCells_, numQPs, cellDims, cellDims);
+    DynRankViewMeshScalarT weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPs);
+    trans_gradBasis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(trans_gradBasis_refPointsSide_buffer, trans_gradBasis_refPointsSide_buffer.data(), numCells_, numNodes, numQPs, cellDims);
+    weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPs);
+
+    Kokkos::parallel_for(ThicknessResid_Coords_Policy(0, numCells_), *this);
+
+    // Calculate side geometry
+    ICT::setJacobian(jacobianSide, refPointsSide[side], physPointsCell, *cellType);
+
+    ICT::setJacobianInv(invJacobianSide, jacobianSide);
+
+    if (sideDims[side] < 2) { //for 1 and 2D, get weighted edge measure
+      FST::computeEdgeMeasure(weighted_measure, jacobianSide, cubWeightsSide[side], side, *cellType, temporary_buffer);
+    } else { //for 3D, get weighted face measure
+      FST::computeFaceMeasure(weighted_measure, jacobianSide, cubWeightsSide[side], side, *cellType, temporary_buffer);
+    }
 
-      // Get dof at cubature points of appropriate side (see DOFVecInterpolation evaluator)
-      for (int i = 0; i < numSideNodes; ++i){
-        std::size_t node = side.node[i];
-        for (std::size_t qp = 0; qp < numQPsSide; ++qp) {
-          const MeshScalarT& tmp = trans_basis_refPointsSide(0, node, qp);
-          dH_Side(qp) += dH_Cell(node) * tmp;
-          SMB_Side(qp) += SMB_Cell(node) * tmp;
-          H0_Side(qp) += H0_Cell(node) * tmp;
-          for (std::size_t dim = 0; dim < numVecFODims; ++dim)
-            V_Side(qp, dim) += V_Cell(node, dim) * tmp;
-        }
-      }
+    // Transform the gradients of the basis functions
+    FST::HGRADtransformGRAD(trans_gradBasis_refPointsSide, invJacobianSide, basisGrad_refPointsSide[side]);
 
-      for (std::size_t qp = 0; qp < numQPsSide; ++qp) {
-        for (int i = 0; i < numSideNodes; ++i){
-          std::size_t node = side.node[i];
-          for (std::size_t dim = 0; dim < numVecFODims; ++dim) {
-            const MeshScalarT& tmp = trans_gradBasis_refPointsSide(0, node, qp, dim);
-            gradH_Side(qp, dim) += H0_Cell(node) * tmp;
-            divV_Side(qp) += V_Cell(node, dim) * tmp;
-          }
-        }
-      }
+    // Multiply with weighted measure
+    FST::multiplyMeasure(weighted_trans_basis_refPointsSide, weighted_measure, basis_refPointsSide[side]);
 
-      for (int i = 0; i < numSideNodes; ++i){
-        std::size_t node = side.node[i];
-        ScalarT res = 0;
-        for (std::size_t qp = 0; qp < numQPsSide; ++qp) {
-          ScalarT divHV = divV_Side(qp)* H0_Side(qp);
-          for (std::size_t dim = 0; dim < numVecFODims; ++dim)
-            divHV += gradH_Side(qp, dim)*V_Side(qp,dim);
-
-         ScalarT tmp = dH_Side(qp) + (*dt/1000.0) * divHV - *dt*SMB_Side(qp);
-          res +=tmp * weighted_trans_basis_refPointsSide(0, node, qp);
-        }
-        Residual(elem_LID,node) = res;
-      }
-    }
+    Kokkos::parallel_for(ThicknessResid_Side_Policy(0, numCells_), *this);
   }
 }
 
@@ -9,6 +9,7 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Albany_Utils.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce {
 
@@ -52,6 +53,8 @@ template<typename EvalT, typename Traits>
 void Time<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   time(0) = workset.current_time;
 
   Albany::MDArray timeOld = (*workset.stateArrayPtr)[timeName];
@@ -9,6 +9,7 @@
 #include "Teuchos_VerboseObject.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_Print.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -46,6 +47,8 @@ namespace LandIce
   void VerticalVelocity<EvalT,Traits,Type>::
   evaluateFields(typename Traits::EvalData d)
   {
+    PHAL_MONITOR_EVALUATOR(EvalT,d);
+
     for (std::size_t cell = 0; cell < d.numCells; ++cell)
       for (std::size_t node = 0; node < numNodes; ++node)
         w(cell,node) = thickness(cell,node) * int1Dw_z(cell,node);
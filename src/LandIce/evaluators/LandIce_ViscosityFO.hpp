@@ -75,6 +75,10 @@ private:
   bool performContinuousHomotopy;
   double expCoeff;
 
+  // Homotopy-dependent quantities, computed once per workset
+  ScalarT ff;             // regularization of the strain rate
+  ScalarT homotopyScale;  // weight of the constant viscosity in the continuous homotopy
+
 
   // Output:
   PHX::MDField<OutputScalarT,Cell,QuadPoint> mu;  // [k^2 Pa yr], k=1000
@@ -105,6 +109,11 @@ public:
   struct ViscosityFO_GLENSLAW_XZ_FROMFILE_Tag{};
   struct ViscosityFO_GLENSLAW_XZ_FROMCISM_Tag{};
 
+  // Glen's law without stereographic map, with flow rate type, dimension and
+  // homotopy resolved at compile time, so that the QP loop has no branches
+  template<int FlowRateType, int NumDims, bool ContinuousHomotopy>
+  struct ViscosityFO_GLENSLAW_Tag{};
+
   typedef Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_EXPTRIG_Tag> ViscosityFO_EXPTRIG_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_CONSTANT_Tag> ViscosityFO_CONSTANT_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_GLENSLAW_UNIFORM_Tag> ViscosityFO_GLENSLAW_UNIFORM_Policy;
@@ -114,6 +123,8 @@ public:
   typedef Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_GLENSLAW_XZ_TEMPERATUREBASED_Tag> ViscosityFO_GLENSLAW_XZ_TEMPERATUREBASED_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_GLENSLAW_XZ_FROMFILE_Tag> ViscosityFO_GLENSLAW_XZ_FROMFILE_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_GLENSLAW_XZ_FROMCISM_Tag> ViscosityFO_GLENSLAW_XZ_FROMCISM_Policy;
+  template<int FlowRateType, int NumDims, bool ContinuousHomotopy>
+  using ViscosityFO_GLENSLAW_Policy = Kokkos::RangePolicy<ExecutionSpace, ViscosityFO_GLENSLAW_Tag<FlowRateType,NumDims,ContinuousHomotopy>>;
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const ViscosityFO_EXPTRIG_Tag& tag, const int& i) const;
@@ -142,6 +153,10 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const ViscosityFO_GLENSLAW_XZ_FROMCISM_Tag& tag, const int& i) const;
 
+  template<int FlowRateType, int NumDims, bool ContinuousHomotopy>
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ViscosityFO_GLENSLAW_Tag<FlowRateType,NumDims,ContinuousHomotopy>& tag, const int& i) const;
+
   KOKKOS_INLINE_FUNCTION
   void glenslaw (const ScalarT &flowFactorVec, const int& cell) const;
 
@@ -150,6 +165,10 @@ public:
 
   double R, x_0, y_0, R2;
 
+private:
+  // Launch the ViscosityFO_GLENSLAW_Tag kernel matching numDims and the homotopy
+  template<int FlowRateType>
+  void dispatchGlensLaw (const int numCells) const;
 };
 
 } // Namespace LandIce
@@ -12,6 +12,7 @@
 #include "PHAL_AlbanyTraits.hpp"
 #include "LandIce_ViscosityFO.hpp"
 #include "LandIce_ViscosityFO.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -238,109 +239,80 @@ template<typename EvalT, typename Traits, typename VelT, typename TemprT>
 KOKKOS_INLINE_FUNCTION
 void ViscosityFO<EvalT, Traits, VelT, TemprT>::glenslaw (const ScalarT &flowFactorVec, const int& cell) const
 {
+  // Glen's law with stereographic map. Without the map, see the ViscosityFO_GLENSLAW_Tag kernels
   double power = 0.5*(1.0/n - 1.0);
-  //ScalarT scale = std::pow(1.0-homotopyParam(0),8);
-  ScalarT scale = performContinuousHomotopy ? std::pow(1.0-homotopyParam(0),expCoeff) : ScalarT(0);
-  if (0)//homotopyParam(0) == 0.0)
+  ScalarT epsilonEqpSq = 0.0;
+  for (int qp=0; qp < numQPs; ++qp)
   {
-    //set constant viscosity
+    MeshScalarT x = coordVec(cell,qp,0)-x_0;
+    MeshScalarT y = coordVec(cell,qp,1)-y_0;
+    MeshScalarT h = 4.0*R2/(4.0*R2 + x*x + y*y);
+    MeshScalarT invh_x = x/2.0/R2;
+    MeshScalarT invh_y = y/2.0/R2;
+
+    OutputScalarT eps00 = Ugrad(cell,qp,0,0)/h-invh_y*U(cell,qp,1); //epsilon_xx
+    OutputScalarT eps01 = (Ugrad(cell,qp,0,1)/h+invh_x*U(cell,qp,0)+Ugrad(cell,qp,1,0)/h+invh_y*U(cell,qp,1))/2.0; //epsilon_xy
+    OutputScalarT eps02 = Ugrad(cell,qp,0,2)/2.0; //epsilon_xz
+    OutputScalarT eps11 = Ugrad(cell,qp,1,1)/h-invh_x*U(cell,qp,0); //epsilon_yy
+    OutputScalarT eps12 = Ugrad(cell,qp,1,2)/2.0; //epsilon_yz
+
+    epsilonEqpSq = eps00*eps00 + eps11*eps11 + eps00*eps11 + eps01*eps01 + eps02*eps02 + eps12*eps12;
+    if (extractStrainRateSq)
+      epsilonSq(cell,qp) = epsilonEqpSq;
+    epsilonEqpSq += ff; //add regularization "fudge factor"
+    mu(cell,qp) = flowFactorVec*pow(epsilonEqpSq,  power); //non-linear viscosity, given by Glen's law
+  }
+  if(useStiffeningFactor)
     for (int qp=0; qp < numQPs; ++qp)
-    {
-      mu(cell,qp) = flowFactorVec;
-    }
+      mu(cell,qp) *= std::exp(stiffeningFactor(cell,qp));
+}
+
+template<typename EvalT, typename Traits, typename VelT, typename TemprT>
+template<int FlowRateType, int NumDims, bool ContinuousHomotopy>
+KOKKOS_INLINE_FUNCTION
+void ViscosityFO<EvalT, Traits, VelT, TemprT>::
+operator () (const ViscosityFO_GLENSLAW_Tag<FlowRateType,NumDims,ContinuousHomotopy>&, const int& cell) const
+{
+  const double power = 0.5*(1.0/n - 1.0);
+
+  // FlowRateType is a compile-time constant, so only one branch survives
+  TemprT flowFactorVec;
+  switch (FlowRateType)
+  {
+    case TEMPERATUREBASED:
+      flowFactorVec = 1.0/2.0*pow(flowRate<TemprT>(temperature(cell)), -1.0/n);
+      break;
+    case FROMFILE:
+    case FROMCISM:
+      flowFactorVec = 1.0/2.0*pow(flowFactorA(cell), -1.0/n);
+      break;
+    default:
+      flowFactorVec = 1.0/2.0*std::pow(A, -1.0/n);
   }
-  else
+
+  for (int qp=0; qp < numQPs; ++qp)
   {
-    ScalarT ff = pow(10.0, -10.0*homotopyParam(0));
-    ScalarT epsilonEqpSq = 0.0;
-    if(useStereographicMap)
-    {
-      if (extractStrainRateSq)
-      {
-        //evaluate non-linear viscosity, given by Glen's law, at quadrature points
-      for (int qp=0; qp < numQPs; ++qp)
-      {
-        MeshScalarT x = coordVec(cell,qp,0)-x_0;
-        MeshScalarT y = coordVec(cell,qp,1)-y_0;
-        MeshScalarT h = 4.0*R2/(4.0*R2 + x*x + y*y);
-        MeshScalarT invh_x = x/2.0/R2;
-        MeshScalarT invh_y = y/2.0/R2;
-
-        OutputScalarT eps00 = Ugrad(cell,qp,0,0)/h-invh_y*U(cell,qp,1); //epsilon_xx
-        OutputScalarT eps01 = (Ugrad(cell,qp,0,1)/h+invh_x*U(cell,qp,0)+Ugrad(cell,qp,1,0)/h+invh_y*U(cell,qp,1))/2.0; //epsilon_xy
-        OutputScalarT eps02 = Ugrad(cell,qp,0,2)/2.0; //epsilon_xz
-        OutputScalarT eps11 = Ugrad(cell,qp,1,1)/h-invh_x*U(cell,qp,0); //epsilon_yy
-        OutputScalarT eps12 = Ugrad(cell,qp,1,2)/2.0; //epsilon_yz
-
-        epsilonEqpSq = eps00*eps00 + eps11*eps11 + eps00*eps11 + eps01*eps01 + eps02*eps02 + eps12*eps12;
-        epsilonSq(cell,qp) = epsilonEqpSq;
-        epsilonEqpSq += ff; //add regularization "fudge factor"
-        mu(cell,qp) = flowFactorVec*pow(epsilonEqpSq,  power); //non-linear viscosity, given by Glen's law
-      }
-      }
-      else
-      {
-        for (int qp=0; qp < numQPs; ++qp)
-        {
-          MeshScalarT x = coordVec(cell,qp,0)-x_0;
-          MeshScalarT y = coordVec(cell,qp,1)-y_0;
-          MeshScalarT h = 4.0*R2/(4.0*R2 + x*x + y*y);
-          MeshScalarT invh_x = x/2.0/R2;
-          MeshScalarT invh_y = y/2.0/R2;
-
-          OutputScalarT eps00 = Ugrad(cell,qp,0,0)/h-invh_y*U(cell,qp,1); //epsilon_xx
-          OutputScalarT eps01 = (Ugrad(cell,qp,0,1)/h+invh_x*U(cell,qp,0)+Ugrad(cell,qp,1,0)/h+invh_y*U(cell,qp,1))/2.0; //epsilon_xy
-          OutputScalarT eps02 = Ugrad(cell,qp,0,2)/2.0; //epsilon_xz
-          OutputScalarT eps11 = Ugrad(cell,qp,1,1)/h-invh_x*U(cell,qp,0); //epsilon_yy
-          OutputScalarT eps12 = Ugrad(cell,qp,1,2)/2.0; //epsilon_yz
-
-          epsilonEqpSq = eps00*eps00 + eps11*eps11 + eps00*eps11 + eps01*eps01 + eps02*eps02 + eps12*eps12;
-          epsilonEqpSq += ff; //add regularization "fudge factor"
-          mu(cell,qp) = flowFactorVec*pow(epsilonEqpSq,  power); //non-linear viscosity, given by Glen's law
-        }
-      }
-    }
-    else
-    {
-      if (extractStrainRateSq)
-      {
-        for (int qp=0; qp < numQPs; ++qp)
-        {
-        //evaluate non-linear viscosity, given by Glen's law, at quadrature points
-        typename PHAL::Ref<const VelT>::type u00 = Ugrad(cell,qp,0,0); //epsilon_xx
-        typename PHAL::Ref<const VelT>::type u11 = Ugrad(cell,qp,1,1); //epsilon_yy
-        epsilonEqpSq = u00*u00 + u11*u11 + u00*u11; //epsilon_xx^2 + epsilon_yy^2 + epsilon_xx*epsilon_yy
-        epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,1) + Ugrad(cell,qp,1,0))*(Ugrad(cell,qp,0,1) + Ugrad(cell,qp,1,0)); //+0.25*epsilon_xy^2
-
-        for (int dim = 2; dim < numDims; ++dim) //3D case
-          epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,dim)*Ugrad(cell,qp,0,dim) + Ugrad(cell,qp,1,dim)*Ugrad(cell,qp,1,dim) ); // + 0.25*epsilon_xz^2 + 0.25*epsilon_yz^2
-
-        epsilonSq(cell,qp) = epsilonEqpSq;
-        epsilonEqpSq += ff; //add regularization "fudge factor"
-        mu(cell,qp) = flowFactorVec*(scale + (1.0-scale)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
-        }
-      }
-      else
-      {
-        for (int qp=0; qp < numQPs; ++qp)
-        {
-        //evaluate non-linear viscosity, given by Glen's law, at quadrature points
-        typename PHAL::Ref<const VelT>::type u00 = Ugrad(cell,qp,0,0); //epsilon_xx
-        typename PHAL::Ref<const VelT>::type u11 = Ugrad(cell,qp,1,1); //epsilon_yy
-        epsilonEqpSq = u00*u00 + u11*u11 + u00*u11; //epsilon_xx^2 + epsilon_yy^2 + epsilon_xx*epsilon_yy
-        epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,1) + Ugrad(cell,qp,1,0))*(Ugrad(cell,qp,0,1) + Ugrad(cell,qp,1,0)); //+0.25*epsilon_xy^2
+    //evaluate non-linear viscosity, given by Glen's law, at quadrature points
+    typename PHAL::Ref<const VelT>::type u00 = Ugrad(cell,qp,0,0); //epsilon_xx
+    typename PHAL::Ref<const VelT>::type u11 = Ugrad(cell,qp,1,1); //epsilon_yy
+    OutputScalarT epsilonEqpSq = u00*u00 + u11*u11 + u00*u11; //epsilon_xx^2 + epsilon_yy^2 + epsilon_xx*epsilon_yy
+    epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,1) + Ugrad(cell,qp,1,0))*(Ugrad(cell,qp,0,1) + Ugrad(cell,qp,1,0)); //+0.25*epsilon_xy^2
 
-        for (int dim = 2; dim < numDims; ++dim) //3D case
-          epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,dim)*Ugrad(cell,qp,0,dim) + Ugrad(cell,qp,1,dim)*Ugrad(cell,qp,1,dim) ); // + 0.25*epsilon_xz^2 + 0.25*epsilon_yz^2
+    for (int dim = 2; dim < NumDims; ++dim) //3D case
+      epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,dim)*Ugrad(cell,qp,0,dim) + Ugrad(cell,qp,1,dim)*Ugrad(cell,qp,1,dim) ); // + 0.25*epsilon_xz^2 + 0.25*epsilon_yz^2
 
-        epsilonEqpSq += ff; //add regularization "fudge factor"
-        mu(cell,qp) = flowFactorVec*pow(epsilonEqpSq,  power); //non-linear viscosity, given by Glen's law
-        }
-      }
-    }
-    if(useStiffeningFactor)
-      for (int qp=0; qp < numQPs; ++qp)
-        mu(cell,qp) *= std::exp(stiffeningFactor(cell,qp));
+    if (extractStrainRateSq)
+      epsilonSq(cell,qp) = epsilonEqpSq;
+    epsilonEqpSq += ff; //add regularization "fudge factor"
+
+    //non-linear viscosity, given by Glen's law
+    if (ContinuousHomotopy)
+      mu(cell,qp) = flowFactorVec*(homotopyScale + (1.0-homotopyScale)*pow(epsilonEqpSq,  power));
+    else
+      mu(cell,qp) = flowFactorVec*pow(epsilonEqpSq,  power);
+
+    if (useStiffeningFactor)
+      mu(cell,qp) *= std::exp(stiffeningFactor(cell,qp));
   }
 }
 
@@ -377,44 +349,17 @@ KOKKOS_INLINE_FUNCTION
 void ViscosityFO<EvalT, Traits, VelT, TemprT>::glenslaw_xz (const TemprT &flowFactorVec, const int& cell) const
 {
   double power = 0.5*(1.0/n - 1.0);
-  ScalarT scale = performContinuousHomotopy ? std::pow(1.0-homotopyParam(0),expCoeff) : ScalarT(0);
-  if (0)//homotopyParam(0) == 0.0)
-  {
-    //set constant viscosity
-    for (int qp=0; qp < numQPs; ++qp)
-    {
-      mu(cell,qp) = flowFactorVec;
-    }
-  }
-  else
+  ScalarT epsilonEqpSq = 0.0;
+  for (int qp=0; qp < numQPs; ++qp)
   {
-    ScalarT ff = pow(10.0, -10.0*homotopyParam(0));
-    ScalarT epsilonEqpSq = 0.0;
+    typename PHAL::Ref<const VelT>::type u00 = Ugrad(cell,qp,0,0); //epsilon_xx
+    epsilonEqpSq = u00*u00; //epsilon_xx^2
+    epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,0) + Ugrad(cell,qp,0,1))*(Ugrad(cell,qp,0,0) + Ugrad(cell,qp,0,1)); //+0.25*epsilon_xz^2
     if (extractStrainRateSq)
-    {
-      for (int qp=0; qp < numQPs; ++qp)
-      {
-        typename PHAL::Ref<const VelT>::type u00 = Ugrad(cell,qp,0,0); //epsilon_xx
-        epsilonEqpSq = u00*u00; //epsilon_xx^2
-        epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,0) + Ugrad(cell,qp,0,1))*(Ugrad(cell,qp,0,0) + Ugrad(cell,qp,0,1)); //+0.25*epsilon_xz^2
-        epsilonSq(cell,qp) = epsilonEqpSq;
-        epsilonEqpSq += ff; //add regularization "fudge factor"
-        //mu(cell,qp) = flowFactorVec*(1-homotopyParam(0)+homotopyParam(0)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
-        mu(cell,qp) = flowFactorVec*(scale + (1.0-scale)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
-      }
-    }
-    else
-    {
-      for (int qp=0; qp < numQPs; ++qp)
-      {
-        typename PHAL::Ref<const VelT>::type u00 = Ugrad(cell,qp,0,0); //epsilon_xx
-        epsilonEqpSq = u00*u00; //epsilon_xx^2
-        epsilonEqpSq += 0.25*(Ugrad(cell,qp,0,0) + Ugrad(cell,qp,0,1))*(Ugrad(cell,qp,0,0) + Ugrad(cell,qp,0,1)); //+0.25*epsilon_xz^2
-        epsilonEqpSq += ff; //add regularization "fudge factor"
-        //mu(cell,qp) = flowFactorVec*(1-homotopyParam(0)+homotopyParam(0)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
-        mu(cell,qp) = flowFactorVec*(scale + (1.0-scale)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
-      }
-    }
+      epsilonSq(cell,qp) = epsilonEqpSq;
+    epsilonEqpSq += ff; //add regularization "fudge factor"
+    //mu(cell,qp) = flowFactorVec*(1-homotopyParam(0)+homotopyParam(0)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
+    mu(cell,qp) = flowFactorVec*(homotopyScale + (1.0-homotopyScale)*pow(epsilonEqpSq,  power)); //non-linear viscosity, given by Glen's law
   }
 }
 
@@ -452,11 +397,35 @@ void ViscosityFO<EvalT, Traits, VelT, TemprT>::operator () (const ViscosityFO_GL
 
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits, typename VelT, typename TemprT>
+template<int FlowRateType>
+void ViscosityFO<EvalT, Traits, VelT, TemprT>::
+dispatchGlensLaw (const int numCells) const
+{
+  // Note: without stereographic map, the continuous homotopy has always been
+  //       applied only when the strain rate is extracted as well
+  const bool continuousHomotopy = performContinuousHomotopy && extractStrainRateSq;
+  if (numDims == 2) {
+    if (continuousHomotopy)
+      Kokkos::parallel_for(ViscosityFO_GLENSLAW_Policy<FlowRateType,2,true>(0,numCells),*this);
+    else
+      Kokkos::parallel_for(ViscosityFO_GLENSLAW_Policy<FlowRateType,2,false>(0,numCells),*this);
+  } else {
+    if (continuousHomotopy)
+      Kokkos::parallel_for(ViscosityFO_GLENSLAW_Policy<FlowRateType,3,true>(0,numCells),*this);
+    else
+      Kokkos::parallel_for(ViscosityFO_GLENSLAW_Policy<FlowRateType,3,false>(0,numCells),*this);
+  }
+}
+
 //**********************************************************************
 template<typename EvalT, typename Traits, typename VelT, typename TemprT>
 void ViscosityFO<EvalT, Traits, VelT, TemprT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   switch (visc_type)
@@ -468,29 +437,49 @@ evaluateFields(typename Traits::EvalData workset)
       Kokkos::parallel_for(ViscosityFO_EXPTRIG_Policy(0,workset.numCells),*this);
       break;
     case GLENSLAW:
+      ff = pow(10.0, -10.0*homotopyParam(0));
+      homotopyScale = performContinuousHomotopy ? pow(1.0-homotopyParam(0),expCoeff) : ScalarT(0);
       if(useStereographicMap)
       {
         R = stereographicMapList->get<double>("Earth Radius", 6371);
         x_0 = stereographicMapList->get<double>("X_0", 0);//-136);
         y_0 = stereographicMapList->get<double>("Y_0", 0);//-2040);
         R2 = std::pow(R,2);
-      }
 
-      switch (flowRate_type)
-      {
-        case UNIFORM:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_UNIFORM_Policy(0,workset.numCells),*this);
-          break;
-        case TEMPERATUREBASED:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_TEMPERATUREBASED_Policy(0,workset.numCells),*this);
+        switch (flowRate_type)
+        {
+          case UNIFORM:
+            Kokkos::parallel_for(ViscosityFO_GLENSLAW_UNIFORM_Policy(0,workset.numCells),*this);
+            break;
+          case TEMPERATUREBASED:
+            Kokkos::parallel_for(ViscosityFO_GLENSLAW_TEMPERATUREBASED_Policy(0,workset.numCells),*this);
+            break;
+          case FROMFILE:
+          case FROMCISM:
+            Kokkos::parallel_for(ViscosityFO_GLENSLAW_FROMFILE_Policy(0,workset.numCells),*this);
           break;
-        case FROMFILE:
-        case FROMCISM:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_FROMFILE_Policy(0,workset.numCells),*this);
-        break;
+        }
+      }
+      else
+      {
+        switch (flowRate_type)
+        {
+          case UNIFORM:
+            dispatchGlensLaw<UNIFORM>(workset.numCells);
+            break;
+          case TEMPERATUREBASED:
+            dispatchGlensLaw<TEMPERATUREBASED>(workset.numCells);
+            break;
+          case FROMFILE:
+          case FROMCISM:
+            dispatchGlensLaw<FROMFILE>(workset.numCells);
+            break;
+        }
       }
       break;
     case GLENSLAW_XZ:
+      ff = pow(10.0, -10.0*homotopyParam(0));
+      homotopyScale = performContinuousHomotopy ? pow(1.0-homotopyParam(0),expCoeff) : ScalarT(0);
       switch (flowRate_type)
       {
         case UNIFORM:
@@ -53,6 +53,7 @@ private:
   PHX::MDField<ScalarT,Cell,Node> Residual;
 
   std::string sideName;
+  int sideSetId;
   std::vector<std::vector<int> >  sideNodes;
   int numNodes;
   int numSideNodes;
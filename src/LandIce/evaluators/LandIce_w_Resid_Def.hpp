@@ -15,6 +15,7 @@
 #include "Albany_DiscretizationUtils.hpp"
 
 #include "LandIce_w_Resid.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace LandIce
 {
@@ -95,6 +96,7 @@ namespace LandIce
   void w_Resid<EvalT,Traits,VelocityType>::
   postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& fm)
   {  
+    sideSetId = d.get_side_set_id(sideName);
     d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
   }
 
@@ -102,6 +104,8 @@ namespace LandIce
   void w_Resid<EvalT,Traits,VelocityType>::
   evaluateFields(typename Traits::EvalData d)
   {
+    PHAL_MONITOR_EVALUATOR(EvalT,d);
+
     for (std::size_t cell = 0; cell < d.numCells; ++cell)
       for (std::size_t node = 0; node < numNodes; ++node)
         Residual(cell,node) = 0.0;
@@ -122,9 +126,9 @@ namespace LandIce
     }
 
 
-    if (d.sideSets->find(sideName) != d.sideSets->end())
+    if (sideSetId>=0 && !(*d.indexedSideSets)[sideSetId].empty())
     {
-      const std::vector<Albany::SideStruct>& sideSet = d.sideSets->at(sideName);
+      const std::vector<Albany::SideStruct>& sideSet = (*d.indexedSideSets)[sideSetId];
       for (auto const& it_side : sideSet)
       {
         // Get the local data of side and cell
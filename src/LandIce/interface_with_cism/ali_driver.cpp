@@ -679,6 +679,9 @@ void ali_driver_run(AliToGlimmer * ftg_ptr, double& cur_time_yr, double time_inc
     solveParams.set("Compute Sensitivities", false);
     Teuchos::Array<Teuchos::RCP<const Thyra::VectorBase<double> > > thyraResponses;
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Thyra::MultiVectorBase<double> > > > thyraSensitivities;
+
+    // The solution is read back from the mesh database after the solve
+    albanyApp->getDiscretization()->requireSolutionInMeshDatabase();
     Piro::PerformSolveBase(*solver, solveParams, thyraResponses, thyraSensitivities);
 
     auto disc = albanyApp->getDiscretization();
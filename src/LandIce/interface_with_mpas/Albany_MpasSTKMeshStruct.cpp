@@ -166,10 +166,10 @@ MpasSTKMeshStruct(const Teuchos::RCP<Teuchos::ParameterList>& params,
   numDim = 3;
   int cub = params->get("Cubature Degree",3);
   int worksetSizeMax = params->get("Workset Size",50);
-  int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_vs->localSubDim());
-
   const CellTopologyData& ctd = *shards_ctd.getCellTopologyData();
 
+  int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_vs->localSubDim(), &ctd);
+
   this->meshSpecs[0] = Teuchos::rcp(new Albany::MeshSpecsStruct(ctd, numDim, cub, nsNames, ssNames, worksetSize,
      ebn, ebNameToIndex, this->interleavedOrdering));
 
@@ -285,6 +285,9 @@ void velocity_solver_solve_fo(int nLayers, int globalVerticesStride,
     Teuchos::Array<Teuchos::RCP<const Thyra::VectorBase<double> > > thyraResponses;
     Teuchos::Array<
     Teuchos::Array<Teuchos::RCP<const Thyra::MultiVectorBase<double> > > > thyraSensitivities;
+
+    // The solution is read back from the mesh database after the solve
+    albanyApp->getDiscretization()->requireSolutionInMeshDatabase();
     Piro::PerformSolveBase(*solver, solveParams, thyraResponses, thyraSensitivities);
 
     // Printing responses
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -15,6 +16,7 @@
 #include "Albany_ThyraUtils.hpp"
 
 #include "Albany_FactoriesHelpers.hpp"
+#include "PerformanceContext.hpp"
 
 #include "Piro_PerformSolve.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -92,6 +94,8 @@ int main(int argc, char *argv[])
   Albany::PrintHeader(*out);
 
   bool reportTimers = true;
+  std::string evalTimersJSONFile;
+  Teuchos::RCP<Teuchos::ParameterList> appParams;
   const auto stackedTimer = Teuchos::rcp(
       new Teuchos::StackedTimer("Albany Total Time"));
   Teuchos::TimeMonitor::setStackedTimer(stackedTimer);
@@ -104,11 +108,34 @@ int main(int argc, char *argv[])
     if (cmd.vtune) { Albany::connect_vtune(comm->getRank()); }
 
     Albany::SolverFactory slvrfctry(cmd.yaml_filename, comm);
+    appParams = slvrfctry.getParameters();
 
     Teuchos::ParameterList &debugParams =
         slvrfctry.getParameters()->sublist("Debug Output", true);
     reportTimers = debugParams.get<bool>("Report Timers", true);
 
+    // Per-evaluator timers, only available if compiled in
+    const bool reportEvalTimers = debugParams.get<bool>("Report Evaluator Timers", false);
+#ifndef ALBANY_EVALUATOR_TIMERS
+    if (reportEvalTimers) {
+      *out << "Warning! 'Report Evaluator Timers' requires Albany to be configured with\n"
+           << "         ENABLE_EVALUATOR_TIMERS=ON. No evaluator timers will be reported.\n";
+    }
+#else
+    // Count the Kokkos allocations made by each evaluator
+    if (reportEvalTimers && !Albany::trackKokkosAllocations()) {
+      *out << "Warning! Kokkos allocations cannot be tracked (a profiling library is loaded,\n"
+           << "         or Kokkos is older than 3.2). Evaluator allocations will be reported as 0.\n";
+    }
+#endif
+    util::PerformanceContext::instance().evaluatorMonitor().setEnabled(reportEvalTimers);
+    evalTimersJSONFile = debugParams.get<std::string>("Evaluator Timers JSON File", "");
+
+    // Memory usage of the main phases of the run
+    const bool analyzeMemory = debugParams.get<bool>("Analyze Memory", false);
+    Albany::enableMemoryPhases(analyzeMemory);
+    Albany::MemoryPhase setupMemoryPhase("Setup");
+
     auto const& bt = slvrfctry.getParameters()->get<std::string>("Build Type","NONE");
 
     if (bt=="Tpetra") {
@@ -129,9 +156,17 @@ int main(int argc, char *argv[])
 
     // Create app (null initial guess)
     const auto albanyApp = slvrfctry.createApplication(comm);
+
+    // Compare the solution in the mesh database against the final solution
+    // (what the MPAS/CISM drivers read back after the solve)
+    const bool checkMeshSolution = debugParams.get<bool>("Check Mesh Database Solution", false);
+    if (checkMeshSolution) {
+      albanyApp->getDiscretization()->requireSolutionInMeshDatabase();
+    }
     const auto albanyModel = slvrfctry.createModel(albanyApp);
     const auto solver      = slvrfctry.createSolver(albanyModel,comm);
 
+    setupMemoryPhase.stop();
     stackedTimer->stop("Albany: Setup Time");
 
     std::string solnMethod =
@@ -145,8 +180,11 @@ int main(int argc, char *argv[])
     Teuchos::Array<
         Teuchos::Array<Teuchos::RCP<const Thyra_MultiVector>>>
         thyraSensitivities;
-    Piro::PerformSolve(
-        *solver, solveParams, thyraResponses, thyraSensitivities);
+    {
+      Albany::MemoryPhase solveMemoryPhase("Solve");
+      Piro::PerformSolve(
+          *solver, solveParams, thyraResponses, thyraSensitivities);
+    }
 
     // Check if thyraResponses are product vectors or regular vectors
     Teuchos::RCP<const Thyra_ProductVector> r_prod;
@@ -341,10 +379,21 @@ int main(int argc, char *argv[])
       const RCP<const Thyra_Vector> xfinal = thyraResponses.back();
       auto mnv = Albany::mean(xfinal);
       *out << "\nMain_Solve: MeanValue of final solution " << mnv << std::endl;
+
+      if (checkMeshSolution) {
+        auto diff = Thyra::createMember(xfinal->space());
+        Thyra::V_VmV(diff.ptr(), *albanyApp->getDiscretization()->getSolutionField(), *xfinal);
+        const ST diffNorm = diff->norm_inf();
+        *out << "\nMain_Solve: mesh database solution differs from the final solution by "
+             << diffNorm << std::endl;
+        if (diffNorm != 0.0) ++status;
+      }
       *out << "\nNumber of Failed Comparisons: " << status << std::endl;
 
-      if (debugParams.get<bool>("Analyze Memory", false))
+      if (analyzeMemory) {
         Albany::printMemoryAnalysis(std::cout, comm);
+        Albany::printMemoryPhases(std::cout, comm);
+      }
 
       if (writeToMatrixMarketDistrSolnMap == true) {
         Albany::writeMatrixMarket(xfinal->space(),"xfinal_distributed_map");
@@ -355,6 +404,18 @@ int main(int argc, char *argv[])
   if (!success) status += 10000;
 
   stackedTimer->stop("Albany Total Time");
+
+  // Check timers and memory against reference values (needs stopped timers)
+  if (success && Teuchos::nonnull(appParams)) {
+    try {
+      Albany::RegressionTests regression(appParams);
+      status += regression.checkPerformanceTestResults(
+          stackedTimer, Teuchos::DefaultComm<int>::getComm());
+    }
+    TEUCHOS_STANDARD_CATCH_STATEMENTS(true, std::cerr, success);
+    if (!success) status += 10000;
+  }
+
   if (reportTimers) {
     Teuchos::StackedTimer::OutputOptions options;
     options.output_fraction = true;
@@ -362,6 +423,17 @@ int main(int argc, char *argv[])
     stackedTimer->report(std::cout, Teuchos::DefaultComm<int>::getComm(), options);
   }
 
+  auto& evalMonitor = util::PerformanceContext::instance().evaluatorMonitor();
+  if (evalMonitor.enabled()) {
+    const auto comm = Teuchos::DefaultComm<int>::getComm();
+    evalMonitor.summarize(comm.ptr(), std::cout);
+    if (evalTimersJSONFile != "") {
+      std::ofstream ofs;
+      if (comm->getRank() == 0) ofs.open(evalTimersJSONFile.c_str());
+      evalMonitor.writeJSON(comm.ptr(), ofs);
+    }
+  }
+
   Kokkos::finalize_all();
 
   return status;
@@ -0,0 +1,39 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_ScratchArena.hpp"
+
+#include <algorithm>
+
+namespace PHAL {
+
+void ScratchArena::reset ()
+{
+  if (highWater>capacity()) {
+    // Leave some room, so that slightly larger worksets do not trigger a regrowth
+    const std::size_t newCapacity = highWater + highWater/4;
+    buffer = Kokkos::View<unsigned char*, PHX::Device>("Scratch Arena", newCapacity);
+    allocator = Teuchos::rcp(new utility::StaticAllocator(buffer.data(), newCapacity));
+  }
+  if (!allocator.is_null()) {
+    allocator->clear();
+  }
+  requested = 0;
+}
+
+void* ScratchArena::allocate (const std::size_t bytes)
+{
+  requested += bytes + alignment;
+  highWater = std::max(highWater, requested);
+
+  void* ptr = allocator.is_null() ? nullptr : allocator->allocate(bytes, alignment);
+  if (ptr==nullptr) {
+    ++fallbacks;
+  }
+  return ptr;
+}
+
+} // namespace PHAL
@@ -0,0 +1,103 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_SCRATCH_ARENA_HPP
+#define PHAL_SCRATCH_ARENA_HPP
+
+#include "PHAL_Workset.hpp"
+#include "StaticAllocator.hpp"
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Kokkos_ViewFactory.hpp"
+#include "Sacado.hpp"
+
+#include "Teuchos_RCP.hpp"
+
+#include <string>
+
+namespace PHAL {
+
+/*
+ * Device memory for the temporary views of the evaluators.
+ *
+ * The Application owns one arena, shared by all its field managers, and
+ * resets it at the beginning of each workset. Views obtained with
+ * createScratchView are carved out of one buffer (no allocation at all), and
+ * are valid until the next reset, so they must not be kept across worksets.
+ *
+ * If a workset needs more scratch than available, the requests that do not
+ * fit fall back to a regular (managed) allocation, which is counted in
+ * numFallbacks (the "Arena Fallbacks" of the evaluator monitor), and the
+ * buffer grows to the high-water mark at the next reset.
+ */
+class ScratchArena
+{
+public:
+  ScratchArena () = default;
+
+  //! Reclaim all the scratch, growing the buffer if the last workset overflowed
+  void reset ();
+
+  //! Raw device storage, or nullptr if the arena is full
+  void* allocate (const std::size_t bytes);
+
+  //! A view with the value type of RefViewT (including its derivative
+  //! dimension, for FAD types) and the given dimensions
+  template<typename ViewT, typename RefViewT, typename... Dims>
+  ViewT create (const RefViewT& refView, const std::string& name, const Dims... dims);
+
+  std::size_t capacity () const { return buffer.extent(0); }
+  std::size_t used () const { return allocator.is_null() ? 0 : allocator->used(); }
+  std::size_t highWaterMark () const { return highWater; }
+  std::size_t numFallbacks () const { return fallbacks; }
+
+  static constexpr std::size_t alignment = 64;
+
+private:
+  Kokkos::View<unsigned char*, PHX::Device>   buffer;
+  Teuchos::RCP<utility::StaticAllocator>      allocator;
+
+  // Bytes requested since the last reset (including padding)
+  std::size_t requested = 0;
+  std::size_t highWater = 0;
+  std::size_t fallbacks = 0;
+};
+
+template<typename ViewT, typename RefViewT, typename... Dims>
+ViewT ScratchArena::create (const RefViewT& refView, const std::string& name, const Dims... dims)
+{
+  typedef typename ViewT::value_type                    value_type;
+  typedef typename Sacado::ScalarType<value_type>::type scalar_type;
+
+  // FAD views store dimension_scalar scalars per entry
+  std::size_t size = sizeof(scalar_type);
+  if (Sacado::IsADType<value_type>::value) {
+    size *= Kokkos::dimension_scalar(refView);
+  }
+  for (const std::size_t d : {static_cast<std::size_t>(dims)...}) {
+    size *= d;
+  }
+
+  void* ptr = allocate(size);
+  if (ptr==nullptr) {
+    return Kokkos::createViewWithType<ViewT>(refView, name, dims...);
+  }
+  return Kokkos::createViewWithType<ViewT>(refView, static_cast<typename ViewT::pointer_type>(ptr), dims...);
+}
+
+//! Scratch view from the workset arena (or a regular view, if the workset has no arena)
+template<typename ViewT, typename RefViewT, typename... Dims>
+ViewT createScratchView (const Workset& workset, const RefViewT& refView, const std::string& name, const Dims... dims)
+{
+  if (workset.scratch.is_null()) {
+    return Kokkos::createViewWithType<ViewT>(refView, name, dims...);
+  }
+  return workset.scratch->template create<ViewT>(refView, name, dims...);
+}
+
+} // namespace PHAL
+
+#endif // PHAL_SCRATCH_ARENA_HPP
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
 #include <stack>
 
 #include "Teuchos_VerboseObject.hpp"
@@ -20,6 +21,8 @@ Setup::Setup() :
     _unsavedFields(Teuchos::rcp(new StringSet())),
     _rebootEvals(Teuchos::rcp(new StringSet())),
     _rebootFields(Teuchos::rcp(new StringSet())),
+    _memoizerBudget(-1.0),
+    _memoizerStorage(0),
     _enableMemoizationForParams(false),
     _isParamsSetsSaved(false),
     _unsavedParams(Teuchos::rcp(new StringSet())),
@@ -32,6 +35,8 @@ void Setup::init_problem_params(const Teuchos::RCP<Teuchos::ParameterList> probl
   _enableMemoization = problemParams->get<bool>("Use MDField Memoization", false);
   _enableMemoizationForParams = problemParams->get<bool>("Use MDField Memoization For Parameters", false);
   if (_enableMemoizationForParams) _enableMemoization = true;
+  const double budgetMB = problemParams->get<double>("MDField Memoization Memory Budget (MB)", -1.0);
+  _memoizerBudget = budgetMB < 0.0 ? -1.0 : budgetMB*1024.0*1024.0;
 }
 
 void Setup::init_unsaved_param(const std::string& param) {
@@ -56,9 +61,30 @@ void Setup::reboot_memoizer() {
     auto out = Teuchos::VerboseObjectBase::getDefaultOStream();
     *out << "Rebooting memoizer." << std::endl;
     _rebootEvals = Teuchos::rcp(new StringSet(*_setupEvals));
+    _rebootFirstWs.clear();
   }
 }
 
+bool Setup::reserve_memoizer_storage(const std::size_t bytes) {
+  if (_memoizerBudget >= 0.0 && _memoizerStorage + bytes > _memoizerBudget)
+    return false;
+  _memoizerStorage += bytes;
+  return true;
+}
+
+void Setup::release_memoizer_storage(const std::size_t bytes) {
+  _memoizerStorage -= std::min(bytes, _memoizerStorage);
+}
+
+void Setup::init_side_set_ids(const std::map<std::string,int>& sideSetIds) {
+  _sideSetIds = sideSetIds;
+}
+
+int Setup::get_side_set_id(const std::string& sideSetName) const {
+  const auto it = _sideSetIds.find(sideSetName);
+  return it == _sideSetIds.end() ? -1 : it->second;
+}
+
 void Setup::pre_eval() {
   if (_enableMemoizationForParams) {
     // If the MDFields haven't been computed yet, everything will be computed
@@ -156,10 +182,9 @@ void Setup::print_fields(std::ostream& os) const {
   }
 }
 
-Teuchos::RCP<const StringSet> Setup::get_saved_fields(const std::string& eval) const {
+Teuchos::RCP<const StringSet> Setup::get_saved_fields(const std::string& eval, const int ws) const {
   // If reboot memoizer active, use empty set of fields
-  if (_enableMemoization && _rebootEvals->count(eval) > 0) {
-    _rebootEvals->erase(eval);
+  if (_enableMemoization && in_current_sweep(*_rebootEvals, _rebootFirstWs, eval, ws)) {
     return _rebootFields;
   }
 
@@ -169,8 +194,7 @@ Teuchos::RCP<const StringSet> Setup::get_saved_fields(const std::string& eval) c
       return _savedFieldsWOParams;
 
     // If a parameter has changed, use saved fields w/o parameter
-    if (_unsavedParamsEvals->count(eval) > 0) {
-      _unsavedParamsEvals->erase(eval);
+    if (in_current_sweep(*_unsavedParamsEvals, _unsavedParamsFirstWs, eval, ws)) {
       return _savedFieldsWOParams;
     }
   }
@@ -178,6 +202,24 @@ Teuchos::RCP<const StringSet> Setup::get_saved_fields(const std::string& eval) c
   return _savedFields;
 }
 
+bool Setup::in_current_sweep(StringSet& evals, std::map<std::string,int>& firstWorksets,
+    const std::string& eval, const int ws) const {
+  if (evals.count(eval) == 0) return false;
+
+  // Worksets are evaluated in the same order in every sweep, so the sweep is
+  // over once we get back to the first workset we saw
+  const auto it = firstWorksets.find(eval);
+  if (it == firstWorksets.end()) {
+    firstWorksets[eval] = ws;
+    return true;
+  }
+  if (it->second != ws) return true;
+
+  firstWorksets.erase(it);
+  evals.erase(eval);
+  return false;
+}
+
 void Setup::update_fields(Teuchos::RCP<StringSet> savedFields,
     Teuchos::RCP<StringSet> unsavedFields) {
   if (_enableMemoization) {
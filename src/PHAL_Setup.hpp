@@ -8,6 +8,7 @@
 #define PHAL_SETUP_HPP_
 
 #include <iostream>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -45,6 +46,18 @@ public:
   //! Reboot memoizer (all fields are unsaved on next eval)
   void reboot_memoizer();
 
+  //! Reserve memory for per-workset memoization storage (false if over budget)
+  bool reserve_memoizer_storage(const std::size_t bytes);
+
+  //! Release memory reserved for per-workset memoization storage
+  void release_memoizer_storage(const std::size_t bytes);
+
+  //! Pass the side set ids of the discretization into Setup
+  void init_side_set_ids(const std::map<std::string,int>& sideSetIds);
+
+  //! Get the id of a side set, to index the workset side set lists (-1 if the mesh does not have it)
+  int get_side_set_id(const std::string& sideSetName) const;
+
   //! Setup data before app evaluation functions are called
   void pre_eval();
 
@@ -72,8 +85,8 @@ public:
   //! Print list of _saved/_unsaved MDFields
   void print_fields(std::ostream& os) const;
 
-  //! Get list of saved MDFields
-  Teuchos::RCP<const StringSet> get_saved_fields(const std::string& eval) const;
+  //! Get list of saved MDFields for workset ws
+  Teuchos::RCP<const StringSet> get_saved_fields(const std::string& eval, const int ws) const;
 
 private:
   //! Update list of saved/unsaved MDFields based on unsaved MDFields and field dependencies
@@ -86,6 +99,10 @@ private:
   void print_fields(std::ostream& os, Teuchos::RCP<StringSet> savedFields,
       Teuchos::RCP<StringSet> unsavedFields) const;
 
+  //! Check if eval is in evals, removing it once a whole sweep over the worksets is done
+  bool in_current_sweep(StringSet& evals, std::map<std::string,int>& firstWorksets,
+      const std::string& eval, const int ws) const;
+
   //! Used to ensure postRegistrationSetup only occurs once
   const Teuchos::RCP<StringSet> _setupEvals;
 
@@ -98,6 +115,16 @@ private:
   Teuchos::RCP<StringSet> _rebootEvals;
   const Teuchos::RCP<StringSet> _rebootFields;
 
+  //! First workset of the current sweep for rebooted/unsaved param evaluation types
+  mutable std::map<std::string,int> _rebootFirstWs, _unsavedParamsFirstWs;
+
+  //! Side set name => id, from the discretization
+  std::map<std::string,int> _sideSetIds;
+
+  //! Memory budget (in bytes, negative means unlimited) for per-workset memoization
+  double _memoizerBudget;
+  std::size_t _memoizerStorage;
+
   //! Data structures for memoization of parameters that change occasionally
   bool _enableMemoizationForParams, _isParamsSetsSaved;
   const Teuchos::RCP<StringSet> _unsavedParams;
@@ -66,8 +66,9 @@ template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian> (
       return app->getNumEquations()*(node_count + side_node_count*numLevels);
     }
    }
-   return getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian>(
-     app, app->getEnrichedMeshSpecs()[ebi].get());
+   // Only the equations of one pass of the Jacobian fill are seeded at once
+   // (all of them, unless the problem declared "Jacobian Equation Blocks")
+   return app->getJacobianFillEquations() * app->getEnrichedMeshSpecs()[ebi].get()->ctd.node_count;
 }
 
 template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Tangent> (
@@ -7,13 +7,18 @@
 #ifndef PHAL_UTILITIES
 #define PHAL_UTILITIES
 
+#include <functional>
+#include <map>
 #include <string>
+#include <utility>
 
 #include "Albany_CommTypes.hpp"
+#include "PHAL_Setup.hpp"
 
 #include "Teuchos_RCP.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Phalanx_DataLayout_MDALayout.hpp"
+#include "Sacado_Traits.hpp"
 
 // Forward declarations
 namespace Albany {
@@ -216,9 +221,16 @@ struct ExtendLayout
 };
 
 /*! In the case of a single workset, an MDField may not need to be recomputed.
- *  Currently, this memoizer (which is not really a true memoizer) checks to
- *  see whether the workset index has changed in order to determine whether an
- *  MDField has to be recomputed.
+ *  This memoizer (which is not really a true memoizer) checks to see whether
+ *  the workset index has changed in order to determine whether an MDField has
+ *  to be recomputed.
+ *
+ *  If the evaluated MDFields are passed to enable_memoizer, the memoizer also
+ *  works on multiple worksets: after an MDField flagged as saved has been
+ *  computed on a workset, it is copied into a per-workset storage, and later
+ *  restored from there, rather than recomputed. Copies are made only as long
+ *  as the memory budget in PHAL::Setup allows it; worksets beyond the budget
+ *  are simply recomputed.
  */
 template<typename Traits>
 class MDFieldMemoizer {
@@ -227,38 +239,158 @@ public:
   //! Constructor
   MDFieldMemoizer() :
     _memoizerEnabled(false),
-    _prevWorksetIndex(-1) {
+    _prevWorksetIndex(-1),
+    _prevComputed(false),
+    _setup(nullptr) {
   }
 
-  //! Enable memoizer
+  //! Enable memoizer (single workset only)
   void enable_memoizer() {
     _memoizerEnabled = true;
   }
 
-  //! Check if evaluated MDFields are saved (only works on single workset)
+  //! Enable memoizer, with per-workset storage for the given (evaluated) MDFields
+  //! Note: MDFields must already be bound to their memory
+  template<typename... FieldTypes>
+  void enable_memoizer(Setup& setup, FieldTypes&... fields) {
+    _memoizerEnabled = true;
+    _setup = &setup;
+    _fields.clear();
+    add_fields(fields...);
+  }
+
+  //! Check if evaluated MDFields are saved, restoring them if they were
+  //! stored for this workset
   bool have_saved_data(const typename Traits::EvalData workset,
       const std::vector<Teuchos::RCP<PHX::FieldTag>>& evalFields) {
     if (!_memoizerEnabled) return false;
 
-    // Check workset index
+    // Check if MDField is saved
     bool saved = false;
-    if (workset.wsIndex == _prevWorksetIndex) {
-      // Check if MDField is saved
-      for (const auto & evalField: evalFields) {
-        if (workset.savedMDFields->count(evalField->identifier()) > 0) {
-          saved = true;
-          break;
-        }
+    for (const auto & evalField: evalFields) {
+      if (workset.savedMDFields->count(evalField->identifier()) > 0) {
+        saved = true;
+        break;
       }
     }
-    _prevWorksetIndex = workset.wsIndex;
 
-    return saved;
+    const int ws = workset.wsIndex;
+    bool restored = false;
+    if (!_fields.empty()) {
+      // The MDFields still hold the values computed on the previous workset
+      if (_prevComputed && ws != _prevWorksetIndex) store(_prevWorksetIndex);
+
+      if (!saved) {
+        // Values may change: stored data for this workset is stale
+        release(ws);
+      } else if (ws != _prevWorksetIndex) {
+        restored = restore(ws);
+      }
+    }
+
+    // If saved values are computed now, store them once we move to another workset
+    const bool useSaved = saved && (ws == _prevWorksetIndex || restored);
+    if (!saved || restored) {
+      _prevComputed = false;
+    } else if (!useSaved) {
+      _prevComputed = !_fields.empty();
+    }
+    _prevWorksetIndex = ws;
+
+    return useSaved;
   }
 
 private:
+
+  //! Type-erased per-workset copy of an MDField
+  struct FieldCopy {
+    virtual ~FieldCopy() = default;
+    virtual void store() = 0;
+    virtual void restore() = 0;
+    virtual std::size_t size_in_bytes() const = 0;
+  };
+
+  template<typename FieldType>
+  struct FieldCopyImpl : public FieldCopy {
+    FieldCopyImpl(FieldType& f) : field(f), allocated(false) {}
+    void store() override {
+      // Allocate on first use, so that nothing is allocated if over budget
+      if (!allocated) {
+        copy = Kokkos::create_mirror(typename PHX::Device::memory_space(), field.get_view());
+        allocated = true;
+      }
+      Kokkos::deep_copy(copy, field.get_view());
+    }
+    void restore() override { Kokkos::deep_copy(field.get_view(), copy); }
+    std::size_t size_in_bytes() const override {
+      typedef typename Sacado::ScalarType<typename FieldType::value_type>::type value_type;
+      const auto view = field.get_view();
+      const std::size_t ds = Kokkos::dimension_scalar(view);
+      return view.size()*(ds>0 ? ds : 1)*sizeof(value_type);
+    }
+
+    FieldType& field;
+    bool allocated;
+    decltype(Kokkos::create_mirror(typename PHX::Device::memory_space(),
+                                   std::declval<FieldType&>().get_view())) copy;
+  };
+
+  //! Factory of per-workset copies of an MDField
+  typedef std::function<Teuchos::RCP<FieldCopy>()> CopyFactory;
+
+  void add_fields() {}
+
+  template<typename FieldType, typename... FieldTypes>
+  void add_fields(FieldType& field, FieldTypes&... fields) {
+    FieldType* f = &field;
+    _fields.push_back([f]() -> Teuchos::RCP<FieldCopy> {
+      return Teuchos::rcp(new FieldCopyImpl<FieldType>(*f));
+    });
+    add_fields(fields...);
+  }
+
+  //! Copy current MDField values into the storage of workset ws (if budget allows)
+  void store(const int ws) {
+    auto it = _storage.find(ws);
+    if (it == _storage.end()) {
+      std::vector<Teuchos::RCP<FieldCopy>> copies;
+      std::size_t bytes = 0;
+      for (const auto& f : _fields) {
+        copies.push_back(f());
+        bytes += copies.back()->size_in_bytes();
+      }
+      if (!_setup->reserve_memoizer_storage(bytes)) return;
+      it = _storage.emplace(ws, std::make_pair(copies,bytes)).first;
+    }
+    for (auto& c : it->second.first) c->store();
+  }
+
+  //! Copy stored values of workset ws into the MDFields (if any)
+  bool restore(const int ws) {
+    auto it = _storage.find(ws);
+    if (it == _storage.end()) return false;
+    for (auto& c : it->second.first) c->restore();
+    return true;
+  }
+
+  //! Free the storage of workset ws
+  void release(const int ws) {
+    auto it = _storage.find(ws);
+    if (it == _storage.end()) return;
+    _setup->release_memoizer_storage(it->second.second);
+    _storage.erase(it);
+  }
+
   bool _memoizerEnabled;
   int _prevWorksetIndex;
+
+  //! Whether the MDFields were computed (rather than restored) on the previous
+  //! workset, and therefore should be stored
+  bool _prevComputed;
+
+  Setup* _setup;
+  std::vector<CopyFactory> _fields;
+  std::map<int,std::pair<std::vector<Teuchos::RCP<FieldCopy>>,std::size_t>> _storage;
 };
 
 //! Return field manager name and evaluation type string
@@ -40,6 +40,8 @@ class Epetra_MultiVector;
 
 namespace PHAL {
 
+class ScratchArena;
+
 struct HessianWorkset
 {
   Teuchos::RCP<Thyra_MultiVector> direction_x;
@@ -71,6 +73,38 @@ struct HessianWorkset
   Teuchos::RCP<const Albany::CombineAndScatterManager> p_direction_cas_manager;
 };
 
+// Equation ranges of one pass of the Jacobian fill. Derivatives are only
+// seeded for the equations in [col_begin,col_end), and the derivative w.r.t.
+// equation eq at element node n is stored in slot n*numColEqs(neq)+eq-col_begin.
+// Only the rows of the equations in [row_begin,row_end) are scattered.
+// A negative end means 'all equations', so that the default is the usual
+// single pass fill, with slot n*neq+eq. See "Jacobian Equation Blocks" in
+// the problem parameters.
+struct JacobianPass
+{
+  int col_begin = 0;
+  int col_end   = -1;
+  int row_begin = 0;
+  int row_end   = -1;
+
+  KOKKOS_INLINE_FUNCTION
+  int colEnd (const int neq) const { return col_end<0 ? neq : col_end; }
+  KOKKOS_INLINE_FUNCTION
+  int rowEnd (const int neq) const { return row_end<0 ? neq : row_end; }
+  KOKKOS_INLINE_FUNCTION
+  int numColEqs (const int neq) const { return colEnd(neq) - col_begin; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool isCol (const int eq, const int neq) const { return eq>=col_begin && eq<colEnd(neq); }
+  KOKKOS_INLINE_FUNCTION
+  bool isRow (const int eq, const int neq) const { return eq>=row_begin && eq<rowEnd(neq); }
+
+  KOKKOS_INLINE_FUNCTION
+  int slot (const int node, const int eq, const int neq) const {
+    return numColEqs(neq)*node + eq - col_begin;
+  }
+};
+
 struct Workset
 {
   Workset()
@@ -114,6 +148,14 @@ struct Workset
   Teuchos::RCP<const Albany::SideSetList> sideSets;
   Teuchos::RCP<const Albany::LocalSideSetInfoList> sideSetViews;
 
+  // Same as above, indexed by side set id (see PHAL::Setup::get_side_set_id)
+  Teuchos::RCP<const Albany::IndexedSideSetList> indexedSideSets;
+  Teuchos::RCP<const Albany::IndexedLocalSideSetInfoList> indexedSideSetViews;
+
+  // Memory for the evaluators' temporaries, reset for each workset (see
+  // PHAL_ScratchArena.hpp). May be null.
+  Teuchos::RCP<ScratchArena> scratch;
+
   // jacobian and mass matrix coefficients for matrix fill
   double j_coeff;
   double m_coeff;  // d(x_dot)/dx_{new}
@@ -141,6 +183,10 @@ struct Workset
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>>> local_Vp;
 
   std::vector<PHX::index_size_type> Jacobian_deriv_dims;
+
+  // Current pass of the Jacobian fill (the whole Jacobian, unless the
+  // problem declared equation blocks)
+  JacobianPass jacobian_pass;
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
   Albany::WorksetConn                           wsElNodeEqID;
@@ -148,6 +194,10 @@ struct Workset
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>> wsCoords;
   std::string                                   EBName;
 
+  // Device copy of wsCoords (cell,node,dim), kept by the Application and
+  // reused until the discretization coordinates change. May be empty.
+  Kokkos::View<const RealType***,PHX::Device> wsCoordsView;
+
   // Needed for Schwarz coupling and for dirichlet conditions based on dist
   // parameters.
   Teuchos::RCP<Albany::AbstractDiscretization> disc;
@@ -90,6 +90,19 @@ class AbstractDiscretization
   virtual const LocalSideSetInfoList&
   getSideSetViews(const int ws) const = 0;
 
+  //! Get the ids of the side sets, dense and the same on all ranks, used to
+  //! index the lists below
+  virtual const std::map<std::string, int>&
+  getSideSetIds() const = 0;
+
+  //! Get Side set lists, indexed by side set id
+  virtual const IndexedSideSetList&
+  getIndexedSideSets(const int ws) const = 0;
+
+  //! Get Side set view lists, indexed by side set id
+  virtual const IndexedLocalSideSetInfoList&
+  getIndexedSideSetViews(const int ws) const = 0;
+
   //! Get map from (Ws, El, Local Node, Eq) -> unkLID
   virtual const Conn&
   getWsElNodeEqID() const = 0;
@@ -140,6 +153,12 @@ class AbstractDiscretization
       Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>>>::type&
   getCoords() const = 0;
 
+  //! Revision of the coordinates returned by getCoords(). It changes every
+  //! time their values may change (e.g., on mesh update), so that data
+  //! computed from them can be cached
+  virtual int
+  getCoordsRevision() const { return 0; }
+
   //! Get coordinates (overlap map).
   virtual const Teuchos::ArrayRCP<double>&
   getCoordinates() const = 0;
@@ -295,6 +314,20 @@ class AbstractDiscretization
       const Thyra_MultiVector& solution,
       const double             time,
       const bool               overlapped = false) = 0;
+
+  //! Whether the next writeSolution call has anything to do. If not, callers
+  //! can skip it (and the solution import), calling skipSolutionOutput instead.
+  virtual bool
+  isSolutionOutputStep() const { return true; }
+
+  //! Advance the output step counters, as writeSolution would do
+  virtual void
+  skipSolutionOutput() {}
+
+  //! Request the solution to be copied in the mesh database at every step,
+  //! regardless of the output interval
+  virtual void
+  requireSolutionInMeshDatabase() {}
 };
 
 }  // namespace Albany
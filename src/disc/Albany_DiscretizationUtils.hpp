@@ -40,6 +40,10 @@ class SideStruct
 };
 using SideSetList = std::map<std::string, std::vector<SideStruct>>;
 
+// Side sets of a workset, indexed by the side set id assigned by the discretization
+// (see AbstractDiscretization::getSideSetIds). Side sets with no side in the workset are empty.
+using IndexedSideSetList = std::vector<std::vector<SideStruct>>;
+
 
 // This is a stucture that holds all of the sideset information over all worksets. When running populate mesh,
 //   there can be a huge number of worksets with only a handful (1-20) of entries each, which causes a huge
@@ -69,18 +73,19 @@ using GlobalSideSetList = std::map<std::string, GlobalSideSetInfo>;
 class LocalSideSetInfo
 {
 public:
-  int size;
+  int size = 0;
   Kokkos::View<GO*, Kokkos::LayoutRight>       side_GID;      // (size)
   Kokkos::View<GO*, Kokkos::LayoutRight>       elem_GID;      // (size)
   Kokkos::View<int*, Kokkos::LayoutRight>      elem_LID;      // (size)
   Kokkos::View<int*, Kokkos::LayoutRight>      elem_ebIndex;  // (size)
   Kokkos::View<unsigned*, Kokkos::LayoutRight> side_local_id; // (size)
 
-  int numSides;
+  int numSides = 0;
   Kokkos::View<int*, Kokkos::LayoutRight>      numCellsOnSide; // (sides)
   Kokkos::View<int**, Kokkos::LayoutRight>     cellsOnSide;    // (numSides, sides)
 };
 using LocalSideSetInfoList = std::map<std::string, LocalSideSetInfo>;
+using IndexedLocalSideSetInfoList = std::vector<LocalSideSetInfo>;
 
 class wsLid
 {
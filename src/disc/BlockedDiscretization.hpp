@@ -196,6 +196,24 @@ public:
     return m_blocks[0]->getSideSetViews(workset);
   }
 
+  const std::map<std::string, int>&
+  getSideSetIds() const
+  {
+    return m_blocks[0]->getSideSetIds();
+  }
+
+  const IndexedSideSetList&
+  getIndexedSideSets(const int workset) const
+  {
+    return m_blocks[0]->getIndexedSideSets(workset);
+  }
+
+  const IndexedLocalSideSetInfoList&
+  getIndexedSideSetViews(const int workset) const
+  {
+    return m_blocks[0]->getIndexedSideSetViews(workset);
+  }
+
   //! Get connectivity map from elementGID to workset
   WsLIDList&
   getElemGIDws()
@@ -249,6 +249,12 @@ class AbstractSTKFieldContainer : public AbstractFieldContainer
   virtual void
   transferSolutionToCoords() = 0;
 
+  //! Store solution minus coordinates in the "displacement" field, leaving
+  //! the coordinates untouched (requires "Transfer Solution to Coordinates
+  //! Mode" = "Displacement")
+  virtual void
+  transferSolutionToDisplacement() = 0;
+
  protected:
   // Note: for 3d meshes, coordinates_field3d==coordinates_field (they point to
   // the same field).
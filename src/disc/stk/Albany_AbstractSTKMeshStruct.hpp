@@ -114,6 +114,7 @@ struct AbstractSTKMeshStruct : public AbstractMeshStruct
   int         exoOutputInterval;
 
   bool transferSolutionToCoords;
+  bool transferSolutionAsDisplacement;
 
   int num_time_deriv;
 
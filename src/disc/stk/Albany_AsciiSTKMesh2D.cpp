@@ -273,10 +273,8 @@ Albany::AsciiSTKMesh2D::AsciiSTKMesh2D (const Teuchos::RCP<Teuchos::ParameterLis
   int cub = params->get("Cubature Degree", 3);
   int worksetSizeMax = params->get<int>("Workset Size", DEFAULT_WORKSET_SIZE);
   Teuchos::broadcast<LO,LO>(*commT, 0, &NumElems);
-  int worksetSize = this->computeWorksetSize(worksetSizeMax, NumElems);
-  
-
   const CellTopologyData& ctd = *shards_ctd.getCellTopologyData(); 
+  int worksetSize = this->computeWorksetSize(worksetSizeMax, NumElems, &ctd);
 
   cullSubsetParts(ssNames, ssPartVec);
   this->meshSpecs[0] = Teuchos::rcp (
@@ -392,9 +392,8 @@ AsciiSTKMeshStruct(const Teuchos::RCP<Teuchos::ParameterList>& params,
   numDim = 3;
   int cub = params->get("Cubature Degree",3);
   int worksetSizeMax = params->get<int>("Workset Size",DEFAULT_WORKSET_SIZE);
-  int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_mapT->getNodeNumElements());
-
   const CellTopologyData& ctd = *shards_ctd.getCellTopologyData(); 
+  int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_mapT->getNodeNumElements(), &ctd);
 
   this->meshSpecs[0] = Teuchos::rcp(new MeshSpecsStruct(ctd, numDim, cub,
                              nsNames, ssNames, worksetSize, ebn,
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
 #include <iostream>
 #include "Teuchos_VerboseObject.hpp"
 
@@ -200,9 +201,20 @@ void GenericSTKMeshStruct::SetupFieldData(
   Teuchos::Array<std::string> residual_vector =
     params->get<Teuchos::Array<std::string> >("Residual Vector Components", default_residual_vector);
 
+  transferSolutionToCoords = params->get<bool>("Transfer Solution to Coordinates", false);
+  const std::string transferMode = params->get<std::string>("Transfer Solution to Coordinates Mode", "Coordinates");
+  TEUCHOS_TEST_FOR_EXCEPTION (transferMode!="Coordinates" && transferMode!="Displacement", std::logic_error,
+      "Error! Invalid value '" << transferMode << "' for \"Transfer Solution to Coordinates Mode\".\n"
+      "       Valid choices are 'Coordinates' and 'Displacement'.\n");
+  transferSolutionAsDisplacement = transferSolutionToCoords && transferMode=="Displacement";
+
   // Build the usual Albany fields unless the user explicitly specifies the residual or solution vector layout
   if(user_specified_solution_components && (residual_vector.length() > 0)){
 
+      TEUCHOS_TEST_FOR_EXCEPTION (transferSolutionAsDisplacement, std::logic_error,
+          "Error! \"Transfer Solution to Coordinates Mode\" = 'Displacement' is not supported with\n"
+          "       \"Solution Vector Components\" and \"Residual Vector Components\".\n");
+
       if(interleavedOrdering == DiscType::Interleaved)
         this->fieldContainer = Teuchos::rcp(new MultiSTKFieldContainer<DiscType::Interleaved>(params,
             metaData, bulkData, neq, numDim, sis, solution_vector, num_params));
@@ -245,8 +257,6 @@ void GenericSTKMeshStruct::SetupFieldData(
 
   //Does user want to write coordinates to matrix market file (e.g., for ML analysis)?
   writeCoordsToMMFile = params->get("Write Coordinates to MatrixMarket", false);
-
-  transferSolutionToCoords = params->get<bool>("Transfer Solution to Coordinates", false);
 }
 
 void GenericSTKMeshStruct::setAllPartsIO()
@@ -340,8 +350,20 @@ GenericSTKMeshStruct::getMeshSpecs() const
 }
 
 int GenericSTKMeshStruct::computeWorksetSize(const int worksetSizeMax,
-                                                     const int ebSizeMax) const
+                                                     const int ebSizeMax,
+                                                     const CellTopologyData* ctd) const
 {
+  const std::string policy = params->get<std::string>("Workset Size Policy","Fixed");
+  TEUCHOS_TEST_FOR_EXCEPTION (policy!="Fixed" && policy!="Auto", Teuchos::Exceptions::InvalidParameterValue,
+                              "Invalid Workset Size Policy: " << policy << "; valid options are Fixed and Auto.\n");
+
+  if (policy=="Auto" && ebSizeMax>0) {
+    const int autoSize = computeAutoWorksetSize(ebSizeMax, ctd);
+    // A positive "Workset Size" is still honored as an upper bound
+    const int upperBound = (worksetSizeMax>0 ? std::min(worksetSizeMax,autoSize) : autoSize);
+    return computeWorksetSize(upperBound, ebSizeMax);
+  }
+
   if (worksetSizeMax > ebSizeMax || worksetSizeMax < 1) return ebSizeMax;
   else {
     // compute numWorksets, and shrink workset size to minimize padding
@@ -350,6 +372,54 @@ int GenericSTKMeshStruct::computeWorksetSize(const int worksetSizeMax,
   }
 }
 
+int GenericSTKMeshStruct::computeAutoWorksetSize(const int ebSizeMax,
+                                                 const CellTopologyData* ctd) const
+{
+  // Estimate the bytes per cell touched by a typical evaluator chain
+  // (gather, interpolation, basis functions, residual, scatter) in a
+  // Jacobian evaluation, which is the most memory hungry one.
+  const int dim  = numDim;
+  const int cub  = params->get<int>("Cubature Degree",3);
+  const int neq  = std::max(params->get<int>("Workset Cost Model Equations",0),1);
+
+  // If the topology is not available, assume a linear hypercube
+  const int numNodes = ctd!=nullptr ? static_cast<int>(ctd->node_count) : (1 << dim);
+
+  // Tensor Gauss rule; it slightly overestimates the points on simplices
+  const int qpsPerDim = cub/2 + 1;
+  int numQPs = 1;
+  for (int i=0; i<dim; ++i) {
+    numQPs *= qpsPerDim;
+  }
+
+  // Jacobian FAD types carry one derivative per local dof, plus the value
+  const double derivDim  = numNodes*neq;
+  const double fadBytes  = (derivDim+1)*sizeof(double);
+  const double realBytes = sizeof(double);
+
+  // Solution, residual, and their qp values and gradients
+  const double fadEntries  = neq*(2.0*numNodes + numQPs*(1.0+dim));
+  // BF, wBF, GradBF, wGradBF, and Jacobian, its inverse and determinant at qps
+  const double realEntries = 2.0*numNodes*numQPs*(1.0+dim) + numQPs*(2.0*dim*dim+1.0);
+
+  const double bytesPerCell = fadEntries*fadBytes + realEntries*realBytes;
+  const double budgetKB = params->get<double>("Workset Memory Budget (KB)",4096.0);
+  TEUCHOS_TEST_FOR_EXCEPTION (budgetKB<=0, Teuchos::Exceptions::InvalidParameterValue,
+                              "Error! 'Workset Memory Budget (KB)' must be positive.\n");
+
+  int worksetSize = static_cast<int>(budgetKB*1024.0/bytesPerCell);
+  worksetSize = std::max(1,std::min(worksetSize,ebSizeMax));
+
+  Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
+  *out << "Auto workset size: " << worksetSize << " cells"
+       << " (nodes per cell: " << numNodes << ", qps per cell: " << numQPs
+       << ", equations: " << neq << ", derivative dimension: " << derivDim << ").\n"
+       << "  Estimated footprint: " << bytesPerCell/1024.0 << " KB per cell, "
+       << worksetSize*bytesPerCell/1024.0 << " KB per workset (budget: " << budgetKB << " KB).\n";
+
+  return worksetSize;
+}
+
 void GenericSTKMeshStruct::setDefaultCoordinates3d ()
 {
   // If the mesh is already a 3d mesh, coordinates_field==coordinates_field3d
@@ -1601,11 +1671,18 @@ GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname) const
 #endif
   validPL->set<bool>("Output DTK Field to Exodus", true, "Boolean indicating whether to write dtk field to exodus file");
   validPL->set<int>("Exodus Write Interval", 3, "Step interval to write solution data to Exodus file");
+  validPL->set<bool>("Update Mesh Database At Every Step", false,
+    "Copy the solution in the mesh database at every observed step, not only at the steps written to Exodus file");
+  validPL->set<std::string>("Setup Cache File Prefix", "",
+    "If not empty, cache the Jacobian graph and the side sets of the discretization in (per rank) files with this prefix, and reuse them in later runs with the same mesh topology, decomposition and parameters");
   validPL->set<std::string>("Method", "",
     "The discretization method, parsed in the Discretization Factory");
   validPL->set<int>("Cubature Degree", 3, "Integration order sent to Intrepid2");
   validPL->set<std::string>("Cubature Rule", "", "Integration rule sent to Intrepid2: GAUSS, GAUSS_RADAU_LEFT, GAUSS_RADAU_RIGHT, GAUSS_LOBATTO");
   validPL->set<int>("Workset Size", DEFAULT_WORKSET_SIZE, "Upper bound on workset (bucket) size");
+  validPL->set<std::string>("Workset Size Policy", "Fixed", "How to choose the workset size: Fixed (use Workset Size) or Auto (use a memory cost model)");
+  validPL->set<double>("Workset Memory Budget (KB)", 4096.0, "Target evaluator working set per workset, used if Workset Size Policy is Auto");
+  validPL->set<int>("Workset Cost Model Equations", 0, "Number of equations used by the Auto workset size cost model (default: the problem's)");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
   validPL->set<int>("Interleaved Ordering", 1, "Flag for interleaved or blocked unknown ordering");
   validPL->set<bool>("Separate Evaluators by Element Block", false,
@@ -1637,6 +1714,8 @@ GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname) const
 
   validPL->set<bool>("Use Serial Mesh", false, "Read in a single mesh on PE 0 and rebalance");
   validPL->set<bool>("Transfer Solution to Coordinates", false, "Copies the solution vector to the coordinates for output");
+  validPL->set<std::string>("Transfer Solution to Coordinates Mode", "Coordinates",
+      "How the transferred solution is output: 'Coordinates' (overwrite the mesh coordinates, recreating the output file) or 'Displacement' (nodal displacement field on the reference mesh)");
   validPL->set<bool>("Set All Parts IO", false, "If true, all parts are marked as io parts");
   validPL->set<bool>("Use Composite Tet 10", false, "Flag to use the composite tet 10 basis in Intrepid");
   validPL->set<bool>("Build Node Sets From Side Sets",false,"Flag to build node sets from side sets");
@@ -57,7 +57,12 @@ protected:
       std::map<std::string, stk::mesh::Part*>& partVec);
 
   //! Utility function that uses some integer arithmetic to choose a good worksetSize
-  int computeWorksetSize(const int worksetSizeMax, const int ebSizeMax) const;
+  //! If 'Workset Size Policy' is 'Auto', the size also comes from a memory cost model (see below)
+  int computeWorksetSize(const int worksetSizeMax, const int ebSizeMax,
+                         const CellTopologyData* ctd = nullptr) const;
+
+  //! Largest workset size whose estimated evaluator working set fits in 'Workset Memory Budget (KB)'
+  int computeAutoWorksetSize(const int ebSizeMax, const CellTopologyData* ctd) const;
 
   //! Re-load balance mesh
   void rebalanceInitialMeshT(const Teuchos::RCP<const Teuchos::Comm<int> >& comm);
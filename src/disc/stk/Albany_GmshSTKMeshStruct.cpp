@@ -142,8 +142,8 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
 
   int cub = params->get("Cubature Degree", 3);
   int worksetSizeMax = params->get<int>("Workset Size", DEFAULT_WORKSET_SIZE);
-  int worksetSize = this->computeWorksetSize(worksetSizeMax, NumElems);
   const CellTopologyData& ctd = *shards_ctd.getCellTopologyData(); 
+  int worksetSize = this->computeWorksetSize(worksetSizeMax, NumElems, &ctd);
   cullSubsetParts(ssNames, ssPartVec);
   this->meshSpecs[0] = Teuchos::rcp (
       new Albany::MeshSpecsStruct (ctd, numDim, cub, nsNames, ssNames,
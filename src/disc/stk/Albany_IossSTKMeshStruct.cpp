@@ -214,7 +214,16 @@ Albany::IossSTKMeshStruct::IossSTKMeshStruct(
   TEUCHOS_TEST_FOR_EXCEPT(el_blocks.size() != partVec.size());
 
   int ebSizeMax =  *std::max_element(el_blocks.begin(), el_blocks.end());
-  int worksetSize = this->computeWorksetSize(worksetSizeMax, ebSizeMax);
+
+  // For the Auto workset size, use the most expensive topology among the blocks
+  const CellTopologyData* ctd_max = nullptr;
+  for (int eb=0; eb<numEB; eb++) {
+    const CellTopologyData* ctd_eb = stk::mesh::get_cell_topology(metaData->get_topology(*partVec[eb])).getCellTopologyData();
+    if (ctd_max==nullptr || ctd_eb->node_count>ctd_max->node_count) {
+      ctd_max = ctd_eb;
+    }
+  }
+  int worksetSize = this->computeWorksetSize(worksetSizeMax, ebSizeMax, ctd_max);
 
   // Build a map to get the EB name given the index
   for (int eb=0; eb<numEB; eb++) {
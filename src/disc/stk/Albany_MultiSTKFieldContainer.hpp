@@ -88,6 +88,9 @@ class MultiSTKFieldContainer : public GenericSTKFieldContainer<Interleaved>
   void
   transferSolutionToCoords();
 
+  void
+  transferSolutionToDisplacement();
+
  private:
   void
   fillVectorImpl(
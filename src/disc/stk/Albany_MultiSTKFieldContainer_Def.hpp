@@ -433,6 +433,16 @@ MultiSTKFieldContainer<Interleaved>::transferSolutionToCoords()
       MultiSTKFieldContainer_transferSolutionToCoords_not_implemented);
 }
 
+template <DiscType Interleaved>
+void
+MultiSTKFieldContainer<Interleaved>::transferSolutionToDisplacement()
+{
+  const bool MultiSTKFieldContainer_transferSolutionToDisplacement_not_implemented =
+      true;
+  TEUCHOS_TEST_FOR_EXCEPT(
+      MultiSTKFieldContainer_transferSolutionToDisplacement_not_implemented);
+}
+
 template <DiscType Interleaved>
 void
 MultiSTKFieldContainer<Interleaved>::fillVectorImpl(
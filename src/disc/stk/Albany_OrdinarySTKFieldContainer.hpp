@@ -119,6 +119,9 @@ class OrdinarySTKFieldContainer : public GenericSTKFieldContainer<Interleaved>
   void
   transferSolutionToCoords();
 
+  void
+  transferSolutionToDisplacement();
+
  private:
   void
   fillVectorImpl(
@@ -145,6 +148,7 @@ class OrdinarySTKFieldContainer : public GenericSTKFieldContainer<Interleaved>
   Teuchos::Array<AbstractSTKFieldContainer::VectorFieldType*>
                                               solution_field_dxdp;
   AbstractSTKFieldContainer::VectorFieldType* residual_field;
+  AbstractSTKFieldContainer::VectorFieldType* displacement_field{nullptr};
 
   int num_params{0};
 };
@@ -171,6 +171,19 @@ OrdinarySTKFieldContainer<Interleaved>::OrdinarySTKFieldContainer(
           *solution_field_dxdp[np], Ioss::Field::TRANSIENT);
 #endif
   }
+  // Solution transferred to coordinates, output as displacement of the
+  // reference mesh (see STKDiscretization::writeSolutionToFile)
+  if (params_->get<bool>("Transfer Solution to Coordinates", false) &&
+      params_->get<std::string>("Transfer Solution to Coordinates Mode", "Coordinates") == "Displacement") {
+    displacement_field =
+        &metaData_->declare_field<VFT>(stk::topology::NODE_RANK, "displacement");
+    stk::mesh::put_field_on_mesh(
+        *displacement_field, metaData_->universal_part(), numDim_, nullptr);
+#ifdef ALBANY_SEACAS
+    stk::io::set_field_role(*displacement_field, Ioss::Field::TRANSIENT);
+#endif
+  }
+
   // If the problem requests that the initial guess at the solution equals the
   // input node coordinates, set that here
   /*
@@ -476,6 +489,18 @@ OrdinarySTKFieldContainer<Interleaved>::transferSolutionToCoords()
   Helper::copySTKField(*solution_field[0], *this->coordinates_field);
 }
 
+template <DiscType Interleaved>
+void
+OrdinarySTKFieldContainer<Interleaved>::transferSolutionToDisplacement()
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(displacement_field == nullptr, std::logic_error,
+      "Error! The displacement field was not created. Set \"Transfer Solution to Coordinates Mode\" to \"Displacement\".\n");
+
+  using VFT    = typename AbstractSTKFieldContainer::VectorFieldType;
+  using Helper = STKFieldContainerHelper<VFT>;
+  Helper::differenceSTKField(*solution_field[0], *this->coordinates_field, *displacement_field);
+}
+
 template <DiscType Interleaved>
 void
 OrdinarySTKFieldContainer<Interleaved>::fillVectorImpl(
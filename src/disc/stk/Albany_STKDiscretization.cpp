@@ -13,6 +13,7 @@
 #include "Albany_NodalGraphUtils.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
+#include "Albany_STKSetupCache.hpp"
 #include "Albany_Utils.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 
@@ -46,12 +47,108 @@ extern "C" {
 #endif  // ALBANY_SEACAS
 
 #include <algorithm>
+#include <array>
 #include <math.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <PHAL_Dimension.hpp>
 
+#include "Teuchos_TimeMonitor.hpp"
+
 // Uncomment the following line if you want debug output to be printed to screen
 // #define OUTPUT_TO_SCREEN
 
+namespace {
+
+// Local id of a side within an element, found by hashing the (sorted) node
+// ids of the element sides. The sides of an element are hashed once, the
+// first time one of them is looked up.
+class LocalSideIdMap
+{
+ public:
+  explicit LocalSideIdMap(const stk::mesh::BulkData& bulkData)
+      : bulkData(bulkData)
+  {
+  }
+
+  // Returns -1 if the side is not found (e.g., without node relations)
+  int
+  find(const stk::mesh::Entity elem, const stk::mesh::Entity side)
+  {
+    const unsigned num_elem_nodes = bulkData.num_nodes(elem);
+    const unsigned num_side_nodes = bulkData.num_nodes(side);
+    if (num_elem_nodes == 0 || num_side_nodes == 0 ||
+        num_side_nodes > maxSideNodes) {
+      return -1;
+    }
+
+    const stk::mesh::EntityId elem_id = bulkData.identifier(elem);
+    if (hashedElems.insert(elem_id).second) {
+      const stk::topology        elem_top   = bulkData.bucket(elem).topology();
+      const stk::mesh::Entity*   elem_nodes = bulkData.begin_nodes(elem);
+      unsigned                   ordinals[maxSideNodes];
+      for (unsigned i = 0; i < elem_top.num_sides(); ++i) {
+        const unsigned n = elem_top.side_topology(i).num_nodes();
+        if (n > maxSideNodes) { continue; }
+        elem_top.side_node_ordinals(i, ordinals);
+        for (unsigned j = 0; j < n; ++j) {
+          key[j + 1] = bulkData.identifier(elem_nodes[ordinals[j]]);
+        }
+        makeKey(elem_id, n);
+        // For degenerate elements, the first matching side wins
+        sideIds.emplace(key, i);
+      }
+    }
+
+    const stk::mesh::Entity* side_nodes = bulkData.begin_nodes(side);
+    for (unsigned j = 0; j < num_side_nodes; ++j) {
+      key[j + 1] = bulkData.identifier(side_nodes[j]);
+    }
+    makeKey(elem_id, num_side_nodes);
+
+    const auto it = sideIds.find(key);
+    return it == sideIds.end() ? -1 : static_cast<int>(it->second);
+  }
+
+ private:
+  // Largest side of the supported topologies (the faces of HEX_27)
+  static constexpr unsigned maxSideNodes = 9;
+
+  // Element id, followed by the sorted ids of the side nodes, padded with 0
+  using Key = std::array<stk::mesh::EntityId, maxSideNodes + 1>;
+
+  struct KeyHash
+  {
+    std::size_t
+    operator()(const Key& k) const
+    {
+      std::size_t h = 0;
+      for (const auto id : k) {
+        h ^= std::hash<stk::mesh::EntityId>()(id) + 0x9e3779b9 + (h << 6) +
+             (h >> 2);
+      }
+      return h;
+    }
+  };
+
+  void
+  makeKey(const stk::mesh::EntityId elem_id, const unsigned num_nodes)
+  {
+    key[0] = elem_id;
+    std::sort(key.begin() + 1, key.begin() + 1 + num_nodes);
+    std::fill(key.begin() + 1 + num_nodes, key.end(), 0);
+  }
+
+  const stk::mesh::BulkData&                  bulkData;
+  std::unordered_map<Key, unsigned, KeyHash>  sideIds;
+  std::unordered_set<stk::mesh::EntityId>     hashedElems;
+
+  // Work array
+  Key key;
+};
+
+}  // anonymous namespace
+
 namespace Albany {
 
 STKDiscretization::STKDiscretization(
@@ -67,12 +164,14 @@ STKDiscretization::STKDiscretization(
       comm(comm_),
       neq(stkMeshStruct_->neq),
       sideSetEquations(sideSetEquations_),
+      coordsRevision(0),
       rigidBodyModes(rigidBodyModes_),
       stkMeshStruct(stkMeshStruct_),
       discParams(discParams_),
       interleavedOrdering(stkMeshStruct_->interleavedOrdering)
 {
-  // nothing to do
+  solutionInMeshDatabaseRequired =
+      discParams->get<bool>("Update Mesh Database At Every Step", false);
 }
 
 STKDiscretization::~STKDiscretization()
@@ -608,6 +707,44 @@ STKDiscretization::writeSolutionMV(
   writeSolutionMVToFile(soln, time, overlapped);
 }
 
+bool
+STKDiscretization::isSolutionOutputStep() const
+{
+#ifdef ALBANY_SEACAS
+  // Without exodus output (or with coordinates overwritten by the solution),
+  // someone else may read the mesh database: never skip
+  if (solutionInMeshDatabaseRequired || !stkMeshStruct->exoOutput ||
+      (stkMeshStruct->transferSolutionToCoords &&
+       !stkMeshStruct->transferSolutionAsDisplacement)) {
+    return true;
+  }
+  if (!(outputInterval % stkMeshStruct->exoOutputInterval)) {
+    return true;
+  }
+  for (const auto& it : sideSetDiscretizationsSTK) {
+    const auto& ss_mesh = it.second->stkMeshStruct;
+    if (ss_mesh->exoOutput &&
+        !(it.second->outputInterval % ss_mesh->exoOutputInterval)) {
+      return true;
+    }
+  }
+  return false;
+#else
+  return true;
+#endif
+}
+
+void
+STKDiscretization::skipSolutionOutput()
+{
+#ifdef ALBANY_SEACAS
+  outputInterval++;
+#endif
+  for (auto& it : sideSetDiscretizationsSTK) {
+    it.second->skipSolutionOutput();
+  }
+}
+
 void
 STKDiscretization::writeSolutionToMeshDatabase(
     const Thyra_Vector& soln,
@@ -666,12 +803,21 @@ STKDiscretization::writeSolutionToFile(
     Teuchos::RCP<AbstractSTKFieldContainer> container =
         stkMeshStruct->getFieldContainer();
 
-    container->transferSolutionToCoords();
+    if (stkMeshStruct->transferSolutionAsDisplacement) {
+      // The reference mesh is untouched, so the output file stays the same:
+      // only the displacement field needs updating, and only if written
+      if (!(outputInterval % stkMeshStruct->exoOutputInterval)) {
+        container->transferSolutionToDisplacement();
+      }
+    } else {
+      container->transferSolutionToCoords();
+      ++coordsRevision;
 
-    if (!mesh_data.is_null()) {
-      // Mesh coordinates have changed. Rewrite output file by deleting the mesh
-      // data object and recreate it
-      setupExodusOutput();
+      if (!mesh_data.is_null()) {
+        // Mesh coordinates have changed. Rewrite output file by deleting the mesh
+        // data object and recreate it
+        setupExodusOutput();
+      }
     }
   }
 
@@ -734,12 +880,21 @@ STKDiscretization::writeSolutionMVToFile(
     Teuchos::RCP<AbstractSTKFieldContainer> container =
         stkMeshStruct->getFieldContainer();
 
-    container->transferSolutionToCoords();
+    if (stkMeshStruct->transferSolutionAsDisplacement) {
+      // The reference mesh is untouched, so the output file stays the same:
+      // only the displacement field needs updating, and only if written
+      if (!(outputInterval % stkMeshStruct->exoOutputInterval)) {
+        container->transferSolutionToDisplacement();
+      }
+    } else {
+      container->transferSolutionToCoords();
+      ++coordsRevision;
 
-    if (!mesh_data.is_null()) {
-      // Mesh coordinates have changed. Rewrite output file by deleting the mesh
-      // data object and recreate it
-      setupExodusOutput();
+      if (!mesh_data.is_null()) {
+        // Mesh coordinates have changed. Rewrite output file by deleting the mesh
+        // data object and recreate it
+        setupExodusOutput();
+      }
     }
   }
 
@@ -1194,6 +1349,43 @@ STKDiscretization::computeGraphs()
   m_jac_factory = Teuchos::rcp(new ThyraCrsMatrixFactory(
       m_vs, m_vs, m_overlap_vs, m_overlap_vs));
 
+  // Besides the mesh, the graph depends on the equations (and their coupling
+  // along the columns of a layered mesh), so it can be read from the setup
+  // cache, if enabled. Only the element loops below are skipped.
+  SetupCacheHash graphHash;
+  graphHash.add(neq);
+  for (const auto& it : sideSetEquations) {
+    graphHash.add(it.first);
+    for (const auto& ss_name : it.second) { graphHash.add(ss_name); }
+  }
+  if (sideSetEquations.size() > 0) {
+    const auto lmn = getLayeredMeshNumbering();
+    if (!lmn.is_null()) {
+      graphHash.add(lmn->stride);
+      graphHash.add(static_cast<int>(lmn->ordering));
+      graphHash.add(lmn->numLayers);
+    }
+  }
+  const Teuchos::RCP<STKSetupCache> graphCache =
+      createSetupCache("graph", graphHash.value());
+
+  std::vector<GO>          cachedRows, cachedIndices;
+  std::vector<std::size_t> cachedOffsets;
+  if (!graphCache.is_null() &&
+      graphCache->readGraph(cachedRows, cachedOffsets, cachedIndices)) {
+    for (std::size_t i = 0; i < cachedRows.size(); ++i) {
+      m_jac_factory->insertGlobalIndices(
+          cachedRows[i],
+          Teuchos::arrayView(
+              cachedIndices.data() + cachedOffsets[i],
+              cachedOffsets[i + 1] - cachedOffsets[i]));
+    }
+    *out << "STKDisc: Jacobian graph read from setup cache "
+         << graphCache->fileName() << std::endl;
+    m_jac_factory->fillComplete();
+    return;
+  }
+
   stk::mesh::Selector select_owned_in_part =
       stk::mesh::Selector(metaData.universal_part()) &
       stk::mesh::Selector(metaData.locally_owned_part());
@@ -1373,6 +1565,14 @@ STKDiscretization::computeGraphs()
     }
   }
 
+  if (!graphCache.is_null()) {
+    m_jac_factory->getInsertedGlobalIndices(
+        cachedRows, cachedOffsets, cachedIndices);
+    graphCache->writeGraph(cachedRows, cachedOffsets, cachedIndices);
+    *out << "STKDisc: Jacobian graph written to setup cache "
+         << graphCache->fileName() << std::endl;
+  }
+
   m_jac_factory->fillComplete();
 }
 
@@ -1423,6 +1623,7 @@ STKDiscretization::computeWorksetInfo()
   wsElNodeEqID.resize(numBuckets);
   wsElNodeID.resize(numBuckets);
   coords.resize(numBuckets);
+  ++coordsRevision;
   sphereVolume.resize(numBuckets);
   latticeOrientation.resize(numBuckets);
 
@@ -1797,95 +1998,56 @@ STKDiscretization::computeWorksetInfo()
 void
 STKDiscretization::computeSideSets()
 {
+  TEUCHOS_FUNC_TIME_MONITOR("Albany Setup: computeSideSets");
+
   // Clean up existing sideset structure if remeshing
   for (size_t i = 0; i < sideSets.size(); ++i) {
     sideSets[i].clear();  // empty the ith map
   }
 
-  // iterator over all side_rank parts found in the mesh
-  std::map<std::string, stk::mesh::Part*>::iterator ss =
-      stkMeshStruct->ssPartVec.begin();
-
   int numBuckets = wsEBNames.size();
 
   sideSets.resize(numBuckets);  // Need a sideset list per workset
 
-  while (ss != stkMeshStruct->ssPartVec.end()) {
-    // Get all owned sides in this side set
-    stk::mesh::Selector select_owned_in_sspart =
-        stk::mesh::Selector(*(ss->second)) &
-        stk::mesh::Selector(metaData.locally_owned_part());
-
-    std::vector<stk::mesh::Entity> sides;
-    stk::mesh::get_selected_entities(
-        select_owned_in_sspart,  // sides local to this processor
-        bulkData.buckets(metaData.side_rank()),
-        sides);
-
-    *out << "STKDisc: sideset " << ss->first << " has size " << sides.size()
-         << "  on Proc 0." << std::endl;
-
-    // loop over the sides to see what they are, then fill in the data holder
-    // for side set options, look at
-    // $TRILINOS_DIR/packages/stk/stk_usecases/mesh/UseCase_13.cpp
-
-    for (std::size_t localSideID = 0; localSideID < sides.size();
-         localSideID++) {
-      stk::mesh::Entity sidee = sides[localSideID];
-
-      TEUCHOS_TEST_FOR_EXCEPTION(
-          bulkData.num_elements(sidee) != 1,
-          std::logic_error,
-          "STKDisc: cannot figure out side set topology for side set "
-              << ss->first << std::endl);
-
-      stk::mesh::Entity elem = bulkData.begin_elements(sidee)[0];
-
-      // containing the side. Note that if the side is internal, it will show up
-      // twice in the
-      // element list, once for each element that contains it.
-
-      SideStruct sStruct;
-
-      // Save side (global id)
-      sStruct.side_GID = bulkData.identifier(sidee) - 1;
-
-      // Save elem id. This is the global element id
-      sStruct.elem_GID = bulkData.identifier(elem) - 1;
-
-      int workset = elemGIDws[sStruct.elem_GID]
-                        .ws;  // Get the ws that this element lives in
-
-      // Save elem id. This is the local element id within the workset
-      sStruct.elem_LID = elemGIDws[sStruct.elem_GID].LID;
-
-      // Save the side identifier inside of the element. This starts at zero
-      // here.
-      sStruct.side_local_id = determine_local_side_id(elem, sidee);
-
-      // Save the index of the element block that this elem lives in
-      sStruct.elem_ebIndex =
-          stkMeshStruct->getMeshSpecs()[0]->ebNameToIndex[wsEBNames[workset]];
-
-      SideSetList& ssList =
-          sideSets[workset];  // Get a ref to the side set map for this ws
-      SideSetList::iterator it = ssList.find(
-          ss->first);  // Get an iterator to the correct sideset (if any)
-
-      if (it != ssList.end()) {
-        // The sideset has already been created
-        it->second.push_back(sStruct);  // Save this side to the vector that
-                                        // belongs to the name ss->first
-      } else {
-        // Add the key ss->first to the map, and the side vector to that map
-        std::vector<SideStruct> tmpSSVec;
-        tmpSSVec.push_back(sStruct);
+  // Dense side set ids. ssPartVec is sorted by name, so they are the same on all ranks
+  sideSetIds.clear();
+  for (const auto& it : stkMeshStruct->ssPartVec) {
+    const int id = sideSetIds.size();
+    sideSetIds[it.first] = id;
+  }
 
-        ssList.insert(SideSetList::value_type(ss->first, tmpSSVec));
-      }
+  // The side lists only depend on the mesh and on the workset layout, so
+  // they can be read from the setup cache, if enabled
+  SetupCacheHash sidesHash;
+  for (const auto& it : elemGIDws) {
+    sidesHash.add(it.first);
+    sidesHash.add(it.second.ws);
+    sidesHash.add(it.second.LID);
+  }
+  for (const auto& it : sideSetIds) {
+    sidesHash.add(it.first);
+  }
+  const Teuchos::RCP<STKSetupCache> setupCache =
+      createSetupCache("sides", sidesHash.value());
+  if (setupCache.is_null() ||
+      !setupCache->readSideSets(numBuckets, sideSetIds.size(), indexedSideSets)) {
+    computeIndexedSideSets();
+    if (!setupCache.is_null()) {
+      setupCache->writeSideSets(indexedSideSets);
+      *out << "STKDisc: side sets written to setup cache "
+           << setupCache->fileName() << std::endl;
     }
+  } else {
+    *out << "STKDisc: side sets read from setup cache "
+         << setupCache->fileName() << std::endl;
+  }
 
-    ss++;
+  // Store the side lists by side set name as well
+  for (int ws = 0; ws < numBuckets; ++ws) {
+    for (const auto& it : sideSetIds) {
+      const std::vector<SideStruct>& sides = indexedSideSets[ws][it.second];
+      if (!sides.empty()) { sideSets[ws][it.first] = sides; }
+    }
   }
 
   // =============================================================
@@ -2030,7 +2192,198 @@ STKDiscretization::computeSideSets()
       ss_it++;
     }
   }
-  
+
+  // 6) Same views, indexed by side set id
+  indexedSideSetViews.assign(numBuckets, IndexedLocalSideSetInfoList(sideSetIds.size()));
+  for (int i = 0; i < numBuckets; ++i) {
+    for (const auto& it : sideSetViews[i]) {
+      indexedSideSetViews[i][sideSetIds.at(it.first)] = it.second;
+    }
+  }
+}
+
+void
+STKDiscretization::computeIndexedSideSets()
+{
+  const int numBuckets = wsEBNames.size();
+
+  // Element block index of each workset
+  std::vector<int> wsEbIndex(numBuckets);
+  for (int ws = 0; ws < numBuckets; ++ws) {
+    wsEbIndex[ws] = stkMeshStruct->getMeshSpecs()[0]->ebNameToIndex[wsEBNames[ws]];
+  }
+
+  // Fill the side lists of all worksets in one pass over the sides of each
+  // side set. Elements are hashed on demand, and shared by all side sets.
+  LocalSideIdMap localSideIds(bulkData);
+  indexedSideSets.assign(numBuckets, IndexedSideSetList(sideSetIds.size()));
+
+  // iterator over all side_rank parts found in the mesh
+  std::map<std::string, stk::mesh::Part*>::iterator ss =
+      stkMeshStruct->ssPartVec.begin();
+  while (ss != stkMeshStruct->ssPartVec.end()) {
+    // Get all owned sides in this side set
+    stk::mesh::Selector select_owned_in_sspart =
+        stk::mesh::Selector(*(ss->second)) &
+        stk::mesh::Selector(metaData.locally_owned_part());
+
+    std::vector<stk::mesh::Entity> sides;
+    stk::mesh::get_selected_entities(
+        select_owned_in_sspart,  // sides local to this processor
+        bulkData.buckets(metaData.side_rank()),
+        sides);
+
+    *out << "STKDisc: sideset " << ss->first << " has size " << sides.size()
+         << "  on Proc 0." << std::endl;
+
+    const int ssId = sideSetIds.at(ss->first);
+
+    // loop over the sides to see what they are, then fill in the data holder
+    // for side set options, look at
+    // $TRILINOS_DIR/packages/stk/stk_usecases/mesh/UseCase_13.cpp
+
+    for (std::size_t localSideID = 0; localSideID < sides.size();
+         localSideID++) {
+      stk::mesh::Entity sidee = sides[localSideID];
+
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          bulkData.num_elements(sidee) != 1,
+          std::logic_error,
+          "STKDisc: cannot figure out side set topology for side set "
+              << ss->first << std::endl);
+
+      stk::mesh::Entity elem = bulkData.begin_elements(sidee)[0];
+
+      // containing the side. Note that if the side is internal, it will show up
+      // twice in the
+      // element list, once for each element that contains it.
+
+      SideStruct sStruct;
+
+      // Save side (global id)
+      sStruct.side_GID = bulkData.identifier(sidee) - 1;
+
+      // Save elem id. This is the global element id
+      sStruct.elem_GID = bulkData.identifier(elem) - 1;
+
+      int workset = elemGIDws[sStruct.elem_GID]
+                        .ws;  // Get the ws that this element lives in
+
+      // Save elem id. This is the local element id within the workset
+      sStruct.elem_LID = elemGIDws[sStruct.elem_GID].LID;
+
+      // Save the side identifier inside of the element. This starts at zero
+      // here. Without node relations, search the element sides instead.
+      const int side_id = localSideIds.find(elem, sidee);
+      sStruct.side_local_id =
+          side_id >= 0 ? side_id : determine_local_side_id(elem, sidee);
+
+      // Save the index of the element block that this elem lives in
+      sStruct.elem_ebIndex = wsEbIndex[workset];
+
+      indexedSideSets[workset][ssId].push_back(sStruct);
+    }
+
+    ss++;
+  }
+
+  // Sort the sides by (cell, local side), so that kernels over a side set
+  // access the cells in order
+  for (auto& ws_sides : indexedSideSets) {
+    for (auto& sides : ws_sides) {
+      std::sort(sides.begin(), sides.end(),
+                [](const SideStruct& lhs, const SideStruct& rhs) {
+                  return lhs.elem_LID < rhs.elem_LID ||
+                         (lhs.elem_LID == rhs.elem_LID &&
+                          lhs.side_local_id < rhs.side_local_id);
+                });
+    }
+  }
+}
+
+void
+STKDiscretization::computeSetupCacheMeshKey()
+{
+  setupCacheEnabled = !discParams->get<std::string>(
+      "Setup Cache File Prefix", "").empty();
+  if (!setupCacheEnabled) { return; }
+
+  TEUCHOS_FUNC_TIME_MONITOR("Albany Setup: computeSetupCacheMeshKey");
+
+  // The cached data only depends on the mesh topology on this rank (not on
+  // the coordinates), which is hashed directly: this works for any mesh
+  // source (Exodus, pre-decomposed Exodus, Ascii, Gmsh, extruded, ...),
+  // and costs one linear pass over the owned elements and sides.
+  SetupCacheHash hash;
+
+  // Decomposition
+  hash.add(comm->getSize());
+  hash.add(comm->getRank());
+
+  // Discretization parameters
+  std::ostringstream params;
+  discParams->print(params, Teuchos::ParameterList::PrintOptions().showFlags(false));
+  hash.add(params.str());
+
+  // Owned elements (in bucket order, which determines the worksets), with
+  // their block and nodes
+  const stk::mesh::Selector select_owned =
+      stk::mesh::Selector(metaData.locally_owned_part());
+  for (const auto* bucket :
+       bulkData.get_buckets(stk::topology::ELEMENT_RANK, select_owned)) {
+    hash.add(std::string(bucket->topology().name()));
+    for (const auto* part : bucket->supersets()) {
+      if (part->primary_entity_rank() == stk::topology::ELEMENT_RANK) {
+        hash.add(part->name());
+      }
+    }
+    for (const auto elem : *bucket) {
+      hash.add(bulkData.identifier(elem));
+      const stk::mesh::Entity* nodes = bulkData.begin_nodes(elem);
+      for (unsigned i = 0; i < bulkData.num_nodes(elem); ++i) {
+        hash.add(bulkData.identifier(nodes[i]));
+      }
+    }
+  }
+
+  // Owned sides of each side set, with their nodes and elements
+  for (const auto& it : stkMeshStruct->ssPartVec) {
+    hash.add(it.first);
+    const stk::mesh::Selector select_owned_in_sspart =
+        stk::mesh::Selector(*it.second) & select_owned;
+    for (const auto* bucket :
+         bulkData.get_buckets(metaData.side_rank(), select_owned_in_sspart)) {
+      for (const auto side : *bucket) {
+        hash.add(bulkData.identifier(side));
+        const stk::mesh::Entity* nodes = bulkData.begin_nodes(side);
+        for (unsigned i = 0; i < bulkData.num_nodes(side); ++i) {
+          hash.add(bulkData.identifier(nodes[i]));
+        }
+        const stk::mesh::Entity* elems = bulkData.begin_elements(side);
+        for (unsigned i = 0; i < bulkData.num_elements(side); ++i) {
+          hash.add(bulkData.identifier(elems[i]));
+        }
+      }
+    }
+  }
+
+  setupCacheMeshKey = hash.value();
+}
+
+Teuchos::RCP<STKSetupCache>
+STKDiscretization::createSetupCache(
+    const std::string&  section,
+    const std::uint64_t sectionKey) const
+{
+  if (!setupCacheEnabled) { return Teuchos::null; }
+
+  SetupCacheHash hash;
+  hash.add(setupCacheMeshKey);
+  hash.add(sectionKey);
+
+  const std::string prefix =
+      discParams->get<std::string>("Setup Cache File Prefix");
+  return Teuchos::rcp(new STKSetupCache(prefix, section, hash.value()));
 }
 
 unsigned
@@ -2382,6 +2735,8 @@ STKDiscretization::updateMesh()
 
   transformMesh();
 
+  computeSetupCacheMeshKey();
+
   computeGraphs();
 
   computeWorksetInfo();
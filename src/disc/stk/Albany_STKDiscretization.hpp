@@ -7,6 +7,7 @@
 #ifndef ALBANY_STK_DISCRETIZATION_HPP
 #define ALBANY_STK_DISCRETIZATION_HPP
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,8 @@
 
 namespace Albany {
 
+class STKSetupCache;
+
 typedef shards::Array<GO, shards::NaturalOrder> GIDArray;
 
 struct DOFsStruct
@@ -198,6 +201,24 @@ class STKDiscretization : public AbstractDiscretization
     return sideSetViews.at(workset);
   }
 
+  const std::map<std::string, int>&
+  getSideSetIds() const
+  {
+    return sideSetIds;
+  }
+
+  const IndexedSideSetList&
+  getIndexedSideSets(const int workset) const
+  {
+    return indexedSideSets[workset];
+  }
+
+  const IndexedLocalSideSetInfoList&
+  getIndexedSideSetViews(const int workset) const
+  {
+    return indexedSideSetViews[workset];
+  }
+
   //! Get connectivity map from elementGID to workset
   WsLIDList&
   getElemGIDws()
@@ -267,6 +288,12 @@ class STKDiscretization : public AbstractDiscretization
     return coords;
   }
 
+  int
+  getCoordsRevision() const
+  {
+    return coordsRevision;
+  }
+
   //! Print the coordinates for debugging
   void
   printCoords() const;
@@ -481,6 +508,18 @@ class STKDiscretization : public AbstractDiscretization
       const double             time,
       const bool               overlapped = false);
 
+  bool
+  isSolutionOutputStep() const;
+
+  void
+  skipSolutionOutput();
+
+  void
+  requireSolutionInMeshDatabase()
+  {
+    solutionInMeshDatabaseRequired = true;
+  }
+
    /** Add a solution field
      */
    void addSolutionField(const std::string & fieldName,const std::string & blockId);
@@ -553,6 +592,15 @@ class STKDiscretization : public AbstractDiscretization
   //! Process STK mesh for SideSets
   void
   computeSideSets();
+  //! Fill indexedSideSets from the STK side set parts
+  void
+  computeIndexedSideSets();
+  //! Hash the mesh topology on this rank, if the setup cache is enabled
+  void
+  computeSetupCacheMeshKey();
+  //! Cache of one section of the setup data, or null if not enabled
+  Teuchos::RCP<STKSetupCache>
+  createSetupCache(const std::string& section, const std::uint64_t sectionKey) const;
   //! Call stk_io for creating exodus output file
   void
   setupExodusOutput();
@@ -613,6 +661,15 @@ class STKDiscretization : public AbstractDiscretization
   GlobalSideSetList globalSideSetViews;
   std::map<int, LocalSideSetInfoList> sideSetViews;
 
+  //! side set name => id, and the same side sets indexed by id, per workset
+  std::map<std::string, int>               sideSetIds;
+  std::vector<IndexedSideSetList>          indexedSideSets;
+  std::vector<IndexedLocalSideSetInfoList> indexedSideSetViews;
+
+  //! Hash of the mesh topology on this rank (only if the setup cache is enabled)
+  bool          setupCacheEnabled = false;
+  std::uint64_t setupCacheMeshKey = 0;
+
   //! Connectivity array [workset, element, local-node, Eq] => LID
   Conn wsElNodeEqID;
 
@@ -624,6 +681,7 @@ class STKDiscretization : public AbstractDiscretization
   WorksetArray<std::string>::type                                   wsEBNames;
   WorksetArray<int>::type                                           wsPhysIndex;
   WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>>>::type coords;
+  int                                                               coordsRevision;
   WorksetArray<Teuchos::ArrayRCP<double>>::type  sphereVolume;
   WorksetArray<Teuchos::ArrayRCP<double*>>::type latticeOrientation;
 
@@ -674,6 +732,9 @@ class STKDiscretization : public AbstractDiscretization
 #endif
   DiscType interleavedOrdering;
 
+  //! Whether the solution must be copied in the mesh database at every step
+  bool solutionInMeshDatabaseRequired;
+
  private:
 
   template <typename T, typename ContainerType>
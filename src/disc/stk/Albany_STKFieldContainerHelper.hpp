@@ -39,6 +39,10 @@ struct STKFieldContainerHelper
 
   // Convenience function to copy one field's contents to another
   static void copySTKField(const FieldType& source, FieldType& target);
+
+  // Set target to the difference of two fields (only the first components,
+  // if target has less components than the sources)
+  static void differenceSTKField(const FieldType& source1, const FieldType& source2, FieldType& target);
 };
 
 } // namespace Albany
@@ -186,4 +186,45 @@ copySTKField(const FieldType& source,
   }
 }
 
+template<class FieldType>
+void STKFieldContainerHelper<FieldType>::
+differenceSTKField(const FieldType& source1,
+                   const FieldType& source2,
+                   FieldType& target)
+{
+  constexpr int rank = getRank<FieldType>();
+  TEUCHOS_TEST_FOR_EXCEPTION(rank!=0 && rank!=1, std::runtime_error,
+                             "Error! Can only handle ScalarFieldType and VectorFieldType for now.\n");
+
+  const stk::mesh::BulkData&     mesh = target.get_mesh();
+  const stk::mesh::BucketVector& bv   = mesh.buckets(stk::topology::NODE_RANK);
+
+  using SFT = AbstractSTKFieldContainer::ScalarFieldType;
+  constexpr bool is_SFT = std::is_same<FieldType,SFT>::value;
+  constexpr int nodes_dim = is_SFT ? 0 : 1;
+
+  for(stk::mesh::BucketVector::const_iterator it = bv.begin() ; it != bv.end() ; ++it) {
+    const stk::mesh::Bucket& bucket = **it;
+
+    BucketArray<FieldType> source1_array(source1, bucket);
+    BucketArray<FieldType> source2_array(source2, bucket);
+    BucketArray<FieldType> target_array(target, bucket);
+
+    const int num_target_components = is_SFT ? 1 : target_array.dimension(0);
+    const int num_nodes_in_bucket   = target_array.dimension(nodes_dim);
+
+    TEUCHOS_TEST_FOR_EXCEPTION(!is_SFT && (source1_array.dimension(0) < num_target_components ||
+                                           source2_array.dimension(0) < num_target_components),
+                               std::logic_error,
+                               "Error in stk fields: the target field has more components than the sources."
+                               << std::endl);
+
+    for(int i=0; i<num_nodes_in_bucket; ++i) {
+      for(int j=0; j<num_target_components; ++j) {
+        access(target_array, j, i) = access(source1_array, j, i) - access(source2_array, j, i);
+      }
+    }
+  }
+}
+
 } // namespace Albany
@@ -5,39 +5,123 @@
 //*****************************************************************//
 
 #include <Albany_STKNodeSharing.hpp>
+#include "Albany_config.h"
 #include <stk_util/parallel/CommSparse.hpp>
+#include <stk_util/parallel/ParallelReduce.hpp>
 #include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
 
 //----------------------------------------------------------------------
 
 // AGS 03/2015: This is code from STK that was deprecated, so I moved it here
 //              as part of Albany.
+//
+// The original version sent all local nodes to all other ranks. Now only the
+// nodes on the boundary of the local patch of elements can be shared, and
+// they are matched through a rendezvous: each candidate node is sent to the
+// rank owning its (hashed) id, which tells back every rank holding the node
+// who else holds it. Message volume scales with the partition surface.
+
+namespace {
+
+// Rank in charge of matching the copies of a node
+int rendezvous_rank (const stk::mesh::EntityKey& key, const int num_ranks) {
+  // Mix the bits, so that structured ids are spread evenly among ranks
+  std::uint64_t h = key.id();
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return static_cast<int>(h % static_cast<std::uint64_t>(num_ranks));
+}
+
+// Nodes that may be shared with another rank: nodes on element sides that are
+// not shared by two local elements, and nodes without elements.
+void find_candidate_nodes (const stk::mesh::BulkData& bulk_data,
+                           std::vector<stk::mesh::Entity>& candidates) {
+  std::map<std::vector<stk::mesh::EntityId>,int> side_count;
+  std::set<stk::mesh::Entity> nodes;
+
+  std::vector<unsigned> ordinals;
+  std::vector<stk::mesh::EntityId> side_ids;
+  const stk::mesh::BucketVector& elem_buckets = bulk_data.buckets(stk::topology::ELEMENT_RANK);
+  for (const stk::mesh::Bucket* bucket : elem_buckets) {
+    const stk::topology topo = bucket->topology();
+    for (size_t k=0; k<bucket->size(); ++k) {
+      const stk::mesh::Entity* elem_nodes = bulk_data.begin_nodes((*bucket)[k]);
+      if (topo.num_sides()==0) {
+        // No notion of sides: all nodes are candidates
+        nodes.insert(elem_nodes, elem_nodes+bulk_data.num_nodes((*bucket)[k]));
+        continue;
+      }
+      for (unsigned side=0; side<topo.num_sides(); ++side) {
+        ordinals.resize(topo.side_topology(side).num_nodes());
+        topo.side_node_ordinals(side, ordinals.data());
+        side_ids.resize(ordinals.size());
+        for (size_t n=0; n<ordinals.size(); ++n) {
+          side_ids[n] = bulk_data.identifier(elem_nodes[ordinals[n]]);
+        }
+        std::sort(side_ids.begin(), side_ids.end());
+        ++side_count[side_ids];
+      }
+    }
+  }
+
+  // Sides seen only once are on the boundary of the local patch
+  for (const auto& it : side_count) {
+    if (it.second==1) {
+      for (const stk::mesh::EntityId id : it.first) {
+        nodes.insert(bulk_data.get_entity(stk::topology::NODE_RANK, id));
+      }
+    }
+  }
+
+  const stk::mesh::BucketVector& node_buckets = bulk_data.buckets(stk::topology::NODE_RANK);
+  for (const stk::mesh::Bucket* bucket : node_buckets) {
+    for (size_t k=0; k<bucket->size(); ++k) {
+      if (bulk_data.num_elements((*bucket)[k])==0) {
+        nodes.insert((*bucket)[k]);
+      }
+    }
+  }
+
+  candidates.assign(nodes.begin(), nodes.end());
+}
+
+} // anonymous namespace
 
 void Albany::fix_node_sharing(stk::mesh::BulkData& bulk_data) {
 
     TEUCHOS_FUNC_TIME_MONITOR("Albany Setup: fix_node_sharing");
 
-    stk::CommSparse comm(bulk_data.parallel());
+    const int num_ranks = bulk_data.parallel_size();
+    const int my_rank   = bulk_data.parallel_rank();
+    if (num_ranks==1) return;
 
+    std::vector<stk::mesh::Entity> candidates;
+    find_candidate_nodes(bulk_data, candidates);
+
+    // Step 1: send each candidate node to its rendezvous rank
+    std::map<stk::mesh::EntityKey,std::vector<int>> holders;
+    stk::CommSparse comm(bulk_data.parallel());
     for (int phase=0;phase<2;++phase)
     {
-        for (int i=0;i<bulk_data.parallel_size();++i)
+        for (const stk::mesh::Entity node : candidates)
         {
-            if ( i != bulk_data.parallel_rank() )
+            const stk::mesh::EntityKey key = bulk_data.entity_key(node);
+            const int dest = rendezvous_rank(key, num_ranks);
+            if (dest != my_rank)
             {
-                const stk::mesh::BucketVector& buckets = bulk_data.buckets(stk::topology::NODE_RANK);
-                for (size_t j=0;j<buckets.size();++j)
-                {
-                    const stk::mesh::Bucket& bucket = *buckets[j];
-                    if ( bucket.owned() )
-                    {
-                        for (size_t k=0;k<bucket.size();++k)
-                        {
-                            stk::mesh::EntityKey key = bulk_data.entity_key(bucket[k]);
-                            comm.send_buffer(i).pack<stk::mesh::EntityKey>(key);
-                        }
-                    }
-                }
+                comm.send_buffer(dest).pack<stk::mesh::EntityKey>(key);
+            }
+            else if (phase == 0)
+            {
+                holders[key].push_back(my_rank);
             }
         }
 
@@ -51,21 +135,88 @@ void Albany::fix_node_sharing(stk::mesh::BulkData& bulk_data) {
         }
     }
 
-    for (int i=0;i<bulk_data.parallel_size();++i)
+    for (int i=0;i<num_ranks;++i)
     {
-        if ( i != bulk_data.parallel_rank() )
+        if ( i != my_rank )
         {
             while(comm.recv_buffer(i).remaining())
             {
                 stk::mesh::EntityKey key;
                 comm.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
-                stk::mesh::Entity node = bulk_data.get_entity(key);
-                if ( bulk_data.is_valid(node) )
+                holders[key].push_back(i);
+            }
+        }
+    }
+
+    // Step 2: tell each holder of a node which other ranks hold it
+    size_t num_shared = 0;
+    stk::CommSparse comm_back(bulk_data.parallel());
+    for (int phase=0;phase<2;++phase)
+    {
+        for (const auto& it : holders)
+        {
+            const std::vector<int>& ranks = it.second;
+            if (ranks.size() < 2) continue;
+
+            for (const int dest : ranks)
+            {
+                for (const int other : ranks)
                 {
-                    bulk_data.add_node_sharing(node, i);
+                    if (other == dest) continue;
+                    if (dest != my_rank)
+                    {
+                        comm_back.send_buffer(dest).pack<stk::mesh::EntityKey>(it.first);
+                        comm_back.send_buffer(dest).pack<int>(other);
+                    }
+                    else if (phase == 0)
+                    {
+                        bulk_data.add_node_sharing(bulk_data.get_entity(it.first), other);
+                        ++num_shared;
+                    }
                 }
             }
         }
+
+        if (phase == 0 )
+        {
+            comm_back.allocate_buffers();
+        }
+        else
+        {
+            comm_back.communicate();
+        }
+    }
+
+    for (int i=0;i<num_ranks;++i)
+    {
+        if ( i != my_rank )
+        {
+            while(comm_back.recv_buffer(i).remaining())
+            {
+                stk::mesh::EntityKey key;
+                int other;
+                comm_back.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+                comm_back.recv_buffer(i).unpack<int>(other);
+                bulk_data.add_node_sharing(bulk_data.get_entity(key), other);
+                ++num_shared;
+            }
+        }
     }
-}
 
+#ifdef ALBANY_VERBOSE
+    // Report the message volume: keys sent to rendezvous ranks, distinct
+    // keys there, and sharing pairs (node,rank) found
+    size_t local_counts[3] = {candidates.size(), holders.size(), num_shared};
+    size_t global_counts[3] = {0, 0, 0};
+    stk::all_reduce_sum(bulk_data.parallel(), local_counts, global_counts, 3);
+    if (my_rank == 0)
+    {
+        Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
+        *out << "fix_node_sharing: " << global_counts[0] << " candidate boundary nodes, "
+             << global_counts[1] << " distinct nodes on rendezvous ranks, "
+             << global_counts[2] << " (node,rank) sharing pairs.\n";
+    }
+#else
+    (void) num_shared;
+#endif
+}
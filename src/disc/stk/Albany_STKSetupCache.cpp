@@ -0,0 +1,191 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_STKSetupCache.hpp"
+
+#include "Teuchos_TestForException.hpp"
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <type_traits>
+
+namespace Albany {
+
+namespace {
+
+// Bump if the layout of the file (or of SideStruct) changes
+constexpr char magic[8] = {'A', 'L', 'B', 'S', 'S', 'C', '0', '2'};
+
+static_assert(
+    std::is_trivially_copyable<SideStruct>::value,
+    "SideStruct is written to the setup cache as raw bytes");
+
+template <typename T>
+void
+writeArray(std::ofstream& file, const std::vector<T>& v)
+{
+  const std::int64_t size = v.size();
+  file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  file.write(reinterpret_cast<const char*>(v.data()), size * sizeof(T));
+}
+
+template <typename T>
+bool
+readArray(std::ifstream& file, std::vector<T>& v)
+{
+  std::int64_t size;
+  file.read(reinterpret_cast<char*>(&size), sizeof(size));
+  if (!file.good() || size < 0) { return false; }
+  v.resize(size);
+  file.read(reinterpret_cast<char*>(v.data()), size * sizeof(T));
+  return file.good();
+}
+
+}  // anonymous namespace
+
+void
+SetupCacheHash::add(const void* data, const std::size_t bytes)
+{
+  const unsigned char* c = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < bytes; ++i) {
+    h ^= c[i];
+    h *= 1099511628211ULL;
+  }
+}
+
+STKSetupCache::STKSetupCache(
+    const std::string&  prefix,
+    const std::string&  section_,
+    const std::uint64_t key_)
+    : section(section_), key(key_)
+{
+  std::ostringstream name;
+  name << prefix << "." << section << "." << std::hex << std::setw(16)
+       << std::setfill('0') << key << ".bin";
+  file_name = name.str();
+}
+
+bool
+STKSetupCache::readHeader(std::ifstream& file) const
+{
+  if (!file.good()) { return false; }
+
+  char          file_magic[sizeof(magic)];
+  std::uint64_t file_key;
+  std::string   file_section(section.size(), ' ');
+  file.read(file_magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&file_key), sizeof(file_key));
+  file.read(&file_section[0], file_section.size());
+  return file.good() && std::memcmp(file_magic, magic, sizeof(magic)) == 0 &&
+         file_key == key && file_section == section;
+}
+
+void
+STKSetupCache::writeHeader(std::ofstream& file) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !file.good(),
+      std::runtime_error,
+      "Error! Cannot open setup cache file " << file_name << ".\n");
+
+  file.write(magic, sizeof(magic));
+  file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+  file.write(section.data(), section.size());
+}
+
+bool
+STKSetupCache::readSideSets(
+    const int                        numWorksets,
+    const int                        numSideSets,
+    std::vector<IndexedSideSetList>& sideSets) const
+{
+  std::ifstream file(file_name, std::ios::binary);
+  if (!readHeader(file)) { return false; }
+
+  std::int64_t dims[2];
+  file.read(reinterpret_cast<char*>(dims), sizeof(dims));
+  if (!file.good() || dims[0] != numWorksets || dims[1] != numSideSets) {
+    return false;
+  }
+
+  std::vector<IndexedSideSetList> tmp(
+      numWorksets, IndexedSideSetList(numSideSets));
+  for (auto& ws_sides : tmp) {
+    for (auto& sides : ws_sides) {
+      if (!readArray(file, sides)) { return false; }
+    }
+  }
+
+  sideSets.swap(tmp);
+  return true;
+}
+
+void
+STKSetupCache::writeSideSets(
+    const std::vector<IndexedSideSetList>& sideSets) const
+{
+  std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+  writeHeader(file);
+
+  const std::int64_t dims[2] = {
+      static_cast<std::int64_t>(sideSets.size()),
+      static_cast<std::int64_t>(sideSets.empty() ? 0 : sideSets[0].size())};
+  file.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+  for (const auto& ws_sides : sideSets) {
+    for (const auto& sides : ws_sides) { writeArray(file, sides); }
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !file.good(),
+      std::runtime_error,
+      "Error! Failed to write setup cache file " << file_name << ".\n");
+}
+
+bool
+STKSetupCache::readGraph(
+    std::vector<GO>&          rows,
+    std::vector<std::size_t>& offsets,
+    std::vector<GO>&          indices) const
+{
+  std::ifstream file(file_name, std::ios::binary);
+  if (!readHeader(file)) { return false; }
+
+  std::vector<GO>          tmp_rows, tmp_indices;
+  std::vector<std::size_t> tmp_offsets;
+  if (!readArray(file, tmp_rows) || !readArray(file, tmp_offsets) ||
+      !readArray(file, tmp_indices)) {
+    return false;
+  }
+  if (tmp_offsets.size() != tmp_rows.size() + 1 ||
+      tmp_offsets.back() != tmp_indices.size()) {
+    return false;
+  }
+
+  rows.swap(tmp_rows);
+  offsets.swap(tmp_offsets);
+  indices.swap(tmp_indices);
+  return true;
+}
+
+void
+STKSetupCache::writeGraph(
+    const std::vector<GO>&          rows,
+    const std::vector<std::size_t>& offsets,
+    const std::vector<GO>&          indices) const
+{
+  std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+  writeHeader(file);
+
+  writeArray(file, rows);
+  writeArray(file, offsets);
+  writeArray(file, indices);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !file.good(),
+      std::runtime_error,
+      "Error! Failed to write setup cache file " << file_name << ".\n");
+}
+
+}  // namespace Albany
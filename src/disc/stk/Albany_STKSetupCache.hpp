@@ -0,0 +1,113 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_STK_SETUP_CACHE_HPP
+#define ALBANY_STK_SETUP_CACHE_HPP
+
+#include "Albany_DiscretizationUtils.hpp"
+#include "Albany_ScalarOrdinalTypes.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+//! 64 bits FNV-1a hash, used as key of the setup cache
+class SetupCacheHash
+{
+ public:
+  void
+  add(const void* data, const std::size_t bytes);
+
+  template <typename T>
+  void
+  add(const T& val)
+  {
+    add(&val, sizeof(T));
+  }
+
+  void
+  add(const std::string& s)
+  {
+    add(s.size());
+    add(s.data(), s.size());
+  }
+
+  std::uint64_t
+  value() const
+  {
+    return h;
+  }
+
+ private:
+  std::uint64_t h = 14695981039346656037ULL;
+};
+
+/*
+ * Binary, per-rank cache of setup data of STKDiscretization, enabled with the
+ * "Setup Cache File Prefix" discretization parameter. Each section (the
+ * Jacobian graph built by computeGraphs, the side lists built by
+ * computeSideSets) has its own file.
+ *
+ * The key must hash everything the cached data depends on (mesh connectivity,
+ * decomposition, workset layout, parameters): it is part of the file name, and
+ * is checked again when reading. A missing or mismatching file is not an
+ * error: the data is simply computed, and the cache (re)written.
+ */
+class STKSetupCache
+{
+ public:
+  STKSetupCache(
+      const std::string&  prefix,
+      const std::string&  section,
+      const std::uint64_t key);
+
+  const std::string&
+  fileName() const
+  {
+    return file_name;
+  }
+
+  //! Read the side lists of all worksets. Returns false if the cache is not usable.
+  bool
+  readSideSets(
+      const int                        numWorksets,
+      const int                        numSideSets,
+      std::vector<IndexedSideSetList>& sideSets) const;
+
+  void
+  writeSideSets(const std::vector<IndexedSideSetList>& sideSets) const;
+
+  //! Read the graph, as returned by ThyraCrsMatrixFactory::getInsertedGlobalIndices.
+  //! Returns false if the cache is not usable.
+  bool
+  readGraph(
+      std::vector<GO>&          rows,
+      std::vector<std::size_t>& offsets,
+      std::vector<GO>&          indices) const;
+
+  void
+  writeGraph(
+      const std::vector<GO>&          rows,
+      const std::vector<std::size_t>& offsets,
+      const std::vector<GO>&          indices) const;
+
+ private:
+  bool
+  readHeader(std::ifstream& file) const;
+  void
+  writeHeader(std::ofstream& file) const;
+
+  std::string   file_name;
+  std::string   section;
+  std::uint64_t key;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_STK_SETUP_CACHE_HPP
@@ -85,7 +85,6 @@ SideSetSTKMeshStruct::SideSetSTKMeshStruct (const MeshSpecsStruct& inputMeshSpec
   std::vector<std::string> ssNames; // Empty
   int cub = params->get("Cubature Degree", 3);
   int worksetSizeMax = params->get<int>("Workset Size", DEFAULT_WORKSET_SIZE);
-  int worksetSize = this->computeWorksetSize(worksetSizeMax,inputMeshSpecs.worksetSize);
 
   std::string ebn = "Element Block 0";
   partVec.push_back(&metaData->declare_part_with_topology(ebn, etopology));
@@ -93,6 +92,8 @@ SideSetSTKMeshStruct::SideSetSTKMeshStruct (const MeshSpecsStruct& inputMeshSpec
   this->addElementBlockInfo(0, ebn, partVec[0], shards_ctd);
   const CellTopologyData& ctd = *shards_ctd.getCellTopologyData(); 
 
+  int worksetSize = this->computeWorksetSize(worksetSizeMax,inputMeshSpecs.worksetSize,&ctd);
+
 #ifdef ALBANY_SEACAS
   stk::io::put_io_part_attribute(*partVec[0]);
 #endif
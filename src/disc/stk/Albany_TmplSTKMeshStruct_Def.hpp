@@ -358,7 +358,8 @@ Albany::TmplSTKMeshStruct<Dim, traits>::TmplSTKMeshStruct(
   // Distribute the elems equally. Build total_elems elements, with nodeIDs starting at StartIndex
   elem_map = Teuchos::rcp(new Tpetra_Map(total_elems, StartIndex, commT, Tpetra::GloballyDistributed));
 
-  int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_map->getNodeNumElements() * (triangles ? 2 : 1));
+  const CellTopologyData* ctd_ws = stk::mesh::get_cell_topology(metaData->get_topology(*partVec[0])).getCellTopologyData();
+  int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_map->getNodeNumElements() * (triangles ? 2 : 1), ctd_ws);
 
   for (unsigned int eb=0; eb<numEB; eb++){
 
@@ -854,14 +854,19 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::Array<LO> col(1);
   Teuchos::Array<ST> value(1);
 
+  // Only the rows and columns of the current Jacobian pass are scattered
+  const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     for (std::size_t node = 0; node < this->numNodes; ++node)
       for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
 
-      row[0] = nodeID(cell,node,this->offset[dim]);
-
       int neq = nodeID.extent(2);
 
+      if (!jacPass.isRow(this->offset[dim],neq)) continue;
+
+      row[0] = nodeID(cell,node,this->offset[dim]);
+
       if (f != Teuchos::null) {
         f_nonconstView[row[0]] += this->neumann(cell, node, dim).val();
       }
@@ -873,8 +878,8 @@ evaluateFields(typename Traits::EvalData workset)
         for (unsigned int node_col=0; node_col<this->numNodes; node_col++){
 
           // Loop over equations per node
-          for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
-            lcol = neq * node_col + eq_col;
+          for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+            lcol = jacPass.slot(node_col,eq_col,neq);
 
             // Global column
             col[0] =  nodeID(cell,node_col,eq_col);
@@ -9,6 +9,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -48,6 +49,8 @@ template<typename EvalT, typename Traits>
 void GatherAuxData<EvalT,Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   auto nodeID = workset.wsElNodeEqID;
 #ifdef ALBANY_EPETRA
   if (workset.auxDataPtr != Teuchos::null) { //Epetra case: check if workset.auxDataPtr is null.
@@ -9,6 +9,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -67,9 +68,38 @@ void GatherCoordinateVector<EvalT, Traits>::postRegistrationSetup(typename Trait
 template<typename EvalT, typename Traits>
 void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   unsigned int numCells = workset.numCells;
+
+  // Without displacements, copy from the device copy of the coordinates kept
+  // by the Application, which is filled once and shared by all evaluation types
+  const auto wsCoordsView = workset.wsCoordsView;
+  if (dispVecName.is_null() && wsCoordsView.size()>0 &&
+      wsCoordsView.extent(1)>=numVertices && wsCoordsView.extent(2)>=numDim) {
+    auto coordVecView = coordVec.get_static_view();
+    const int nCells = numCells;
+    const int nVertices = numVertices;
+    const int nDim = numDim;
+
+    // Since Intrepid2 will later perform calculations on the entire workset size
+    // and not just the used portion, we must fill the excess with reasonable
+    // values (those of the first cell).
+    Kokkos::parallel_for(this->getName(),
+                         Kokkos::RangePolicy<PHX::Device::execution_space>(0,worksetSize),
+                         KOKKOS_LAMBDA(const int cell) {
+      const int src = cell<nCells ? cell : 0;
+      for (int node=0; node<nVertices; ++node) {
+        for (int eq=0; eq<nDim; ++eq) {
+          coordVecView(cell,node,eq) = wsCoordsView(src,node,eq);
+        }
+      }
+    });
+    return;
+  }
+
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords = workset.wsCoords;
 
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
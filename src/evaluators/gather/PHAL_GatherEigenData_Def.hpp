@@ -13,6 +13,7 @@
 #include "PHAL_GatherEigenData.hpp"
 #include "Albany_EigendataInfoStruct.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -81,6 +82,8 @@ template<typename EvalT, typename Traits>
 void GatherEigenDataBase<EvalT,Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if(nEigenvectors == 0) {
     return;
   }
@@ -13,6 +13,7 @@
 #include "Albany_EigendataInfoStruct.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "PHAL_GatherEigenvectors.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -60,6 +61,8 @@ template<typename EvalT, typename Traits>
 void GatherEigenvectors<EvalT,Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if(nEigenvectors == 0) return;
 
   auto nodeID = workset.wsElNodeEqID;
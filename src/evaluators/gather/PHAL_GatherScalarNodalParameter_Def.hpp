@@ -12,6 +12,7 @@
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -36,7 +37,7 @@ postRegistrationSetup(typename Traits::SetupData d,
 {
   this->utils.setFieldData(val,fm);
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields(),d.memoizer_for_params_active());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) memoizer.enable_memoizer(d,val);
 }
 
 // **********************************************************************
@@ -63,6 +64,8 @@ template<typename EvalT, typename Traits>
 void GatherScalarNodalParameter<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   Teuchos::RCP<const Thyra_Vector> pvec = workset.distParamLib->get(this->param_name)->overlapped_vector();
@@ -94,6 +97,8 @@ template<typename EvalT, typename Traits>
 void GatherScalarExtruded2DNodalParameter<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // TODO: find a way to abstract away from the map concept. Perhaps using Panzer::ConnManager?
@@ -152,6 +157,8 @@ template<typename Traits>
 void GatherScalarNodalParameter<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // Distributed parameter vector
@@ -240,6 +247,8 @@ template<typename Traits>
 void GatherScalarExtruded2DNodalParameter<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // TODO: find a way to abstract away from the map concept. Perhaps using Panzer::ConnManager?
@@ -346,6 +355,8 @@ template<typename Traits>
 void GatherScalarNodalParameter<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // Distributed parameter vector
@@ -430,6 +441,8 @@ template<typename Traits>
 void GatherScalarExtruded2DNodalParameter<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // TODO: find a way to abstract away from the map concept. Perhaps using Panzer::ConnManager?
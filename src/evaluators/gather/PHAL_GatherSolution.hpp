@@ -225,6 +225,7 @@ public:
 private:
   int neq, numDim;
   double j_coeff, n_coeff, m_coeff;
+  PHAL::JacobianPass jacPass;
 
   typedef GatherSolutionBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
   using Base::nodeID;
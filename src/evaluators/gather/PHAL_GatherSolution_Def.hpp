@@ -15,6 +15,7 @@
 #include "Albany_ThyraUtils.hpp"
 
 #include "PHAL_GatherSolution.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -300,6 +301,8 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   const auto& x       = workset.x;
   const auto& xdot    = workset.xdot;
   const auto& xdotdot = workset.xdotdot;
@@ -486,11 +489,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank2_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = (this->valTensor)(cell,node,eq/numDim,eq%numDim);
       valref=FadType(valref.size(), x_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =j_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = j_coeff;
     }
   }
 }
@@ -500,11 +503,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank2_Transient_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim);
       valref =FadType(valref.size(), xdot_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =m_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = m_coeff;
     }
   }
 }
@@ -514,11 +517,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank2_Acceleration_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim);
       valref=FadType(valref.size(), xdotdot_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =n_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = n_coeff;
     }
   }
 }
@@ -528,11 +531,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank1_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; node++){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = (this->valVec)(cell,node,eq);
       valref =FadType(valref.size(), x_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =j_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = j_coeff;
     }
   }
 }
@@ -542,11 +545,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank1_Transient_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = (this->valVec_dot)(cell,node,eq);
       valref =FadType(valref.size(), xdot_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =m_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = m_coeff;
     }
   }
 }
@@ -556,11 +559,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank1_Acceleration_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = (this->valVec_dotdot)(cell,node,eq);
       valref =FadType(valref.size(), xdotdot_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =n_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = n_coeff;
     }
   }
 }
@@ -570,11 +573,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank0_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = d_val[eq](cell,node);
       valref =FadType(valref.size(), x_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =j_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = j_coeff;
     }
   }
 }
@@ -584,11 +587,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank0_Transient_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = d_val_dot[eq](cell,node);
       valref =FadType(valref.size(), xdot_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =m_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = m_coeff;
     }
   }
 }
@@ -598,11 +601,11 @@ KOKKOS_INLINE_FUNCTION
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 operator() (const PHAL_GatherJacRank0_Acceleration_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
       typename PHAL::Ref<ScalarT>::type valref = d_val_dotdot[eq](cell,node);
       valref = FadType(valref.size(), xdotdot_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) = n_coeff;
+      if (jacPass.isCol(this->offset+eq,neq))
+        valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = n_coeff;
     }
   }
 }
@@ -614,6 +617,8 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   const auto& x       = workset.x;
   const auto& xdot    = workset.xdot;
   const auto& xdotdot = workset.xdotdot;
@@ -632,19 +637,22 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if (this->tensorRank==2) numDim = this->valTensor.extent(2); // only needed for tensor fields
 
+  // Only the equations of the current pass are seeded (see PHAL::JacobianPass)
+  const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     const int neq = nodeID.extent(2);
     const std::size_t num_dof = neq * this->numNodes;
 
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      int firstunk = neq * node + this->offset;
-      for (std::size_t eq = 0; eq < numFields; eq++) {
+        for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT>::type
           valref = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
                     this->valTensor(cell,node, eq/numDim, eq%numDim));
         valref = FadType(valref.size(), x_constView[nodeID(cell,node,this->offset + eq)]);
-        valref.fastAccessDx(firstunk + eq) = workset.j_coeff;
+        if (jacPass.isCol(this->offset+eq,neq))
+          valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = workset.j_coeff;
       }
       if (workset.transientTerms && this->enableTransient) {
         for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -653,7 +661,8 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec_dot(cell,node,eq) :
                     this->valTensor_dot(cell,node, eq/numDim, eq%numDim));
         valref = FadType(valref.size(), xdot_constView[nodeID(cell,node,this->offset + eq)]);
-        valref.fastAccessDx(firstunk + eq) = workset.m_coeff;
+        if (jacPass.isCol(this->offset+eq,neq))
+          valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = workset.m_coeff;
         }
       }
       if (workset.accelerationTerms && this->enableAcceleration) {
@@ -663,7 +672,8 @@ evaluateFields(typename Traits::EvalData workset)
                     this->tensorRank == 1 ? this->valVec_dotdot(cell,node,eq) :
                     this->valTensor_dotdot(cell,node, eq/numDim, eq%numDim));
         valref = FadType(valref.size(), xdotdot_constView[nodeID(cell,node,this->offset + eq)]);
-        valref.fastAccessDx(firstunk + eq) = workset.n_coeff;
+        if (jacPass.isCol(this->offset+eq,neq))
+          valref.fastAccessDx(jacPass.slot(node,this->offset+eq,neq)) = workset.n_coeff;
         }
       }
     }
@@ -679,6 +689,7 @@ evaluateFields(typename Traits::EvalData workset)
 
   // Get dimensions and coefficients
   neq = nodeID.extent(2);
+  jacPass = workset.jacobian_pass;
   j_coeff=workset.j_coeff;
   m_coeff=workset.m_coeff;
   n_coeff=workset.n_coeff;
@@ -798,6 +809,8 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Tangent,workset);
+
   auto nodeID = workset.wsElNodeEqID;
 
   const auto& x       = workset.x;
@@ -908,6 +921,8 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   const auto& x       = workset.x;
   const auto& xdot    = workset.xdot;
@@ -1015,6 +1030,8 @@ template<typename Traits>
 void GatherSolution<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   const auto& x       = workset.x;
   const auto& xdot    = workset.xdot;
   const auto& xdotdot = workset.xdotdot;
@@ -10,6 +10,7 @@
 
 #include "Albany_DiscretizationUtils.hpp"
 #include "PHAL_DOFCellToSideQP.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -113,6 +114,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFCellToSideQPBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end()) {
     return;
   }
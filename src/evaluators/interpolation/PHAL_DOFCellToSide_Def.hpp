@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "PHAL_DOFCellToSide.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -318,6 +319,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFCellToSideBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSetViews->find(sideSetName)==workset.sideSetViews->end()) return;
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
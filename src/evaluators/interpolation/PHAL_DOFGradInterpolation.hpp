@@ -149,6 +149,7 @@ public:
 
   int num_dof;
   int neq;
+  PHAL::JacobianPass jacPass;
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const FastSolutionGradInterpolationBase_Jacobian_Tag& tag, const int& cell) const;
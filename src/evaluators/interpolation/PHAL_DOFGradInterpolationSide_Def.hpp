@@ -11,6 +11,7 @@
 
 #include "PHAL_DOFGradInterpolationSide.hpp"
 #include "Albany_DiscretizationUtils.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -57,6 +58,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFGradInterpolationSideBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
     return;
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
@@ -14,6 +14,7 @@
 
 #include "PHAL_DOFGradInterpolation.hpp"
 #include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -114,6 +115,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFGradInterpolationBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   //Intrepid2 Version:
@@ -177,10 +180,12 @@ evaluateFields(typename Traits::EvalData workset)
     for (int qp=0; qp < this->numQPs; ++qp) {
           for (int dim=0; dim<this->numDims; dim++) {
             this->grad_val_qp(cell,qp,dim) = ScalarT(num_dof, this->val_node(cell, 0).val() * this->GradBF(cell, 0, qp, dim));
-            (this->grad_val_qp(cell,qp,dim)).fastAccessDx(offset) = this->val_node(cell, 0).fastAccessDx(offset) * this->GradBF(cell, 0, qp, dim);
+            if (jacPass.isCol(offset,neq))
+              (this->grad_val_qp(cell,qp,dim)).fastAccessDx(jacPass.slot(0,offset,neq)) = this->val_node(cell, 0).fastAccessDx(jacPass.slot(0,offset,neq)) * this->GradBF(cell, 0, qp, dim);
             for (int node= 1 ; node < this->numNodes; ++node) {
               (this->grad_val_qp(cell,qp,dim)).val() += this->val_node(cell, node).val() * this->GradBF(cell, node, qp, dim);
-              (this->grad_val_qp(cell,qp,dim)).fastAccessDx(neq*node+offset) += this->val_node(cell, node).fastAccessDx(neq*node+offset) * this->GradBF(cell, node, qp, dim);
+              if (jacPass.isCol(offset,neq))
+                (this->grad_val_qp(cell,qp,dim)).fastAccessDx(jacPass.slot(node,offset,neq)) += this->val_node(cell, node).fastAccessDx(jacPass.slot(node,offset,neq)) * this->GradBF(cell, node, qp, dim);
           }
         }
       }
@@ -192,6 +197,7 @@ template<typename Traits>
 void FastSolutionGradInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
 
   //Intrepid2 Version:
   // for (int i=0; i < grad_val_qp.size() ; i++) grad_val_qp[i] = 0.0;
@@ -201,15 +207,18 @@ evaluateFields(typename Traits::EvalData workset)
 
   const int num_dof = this->val_node(0,0).size();
   const int neq = workset.wsElNodeEqID.extent(2);
+  const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
 
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
         for (std::size_t qp=0; qp < this->numQPs; ++qp) {
           for (std::size_t dim=0; dim<this->numDims; dim++) {
             this->grad_val_qp(cell,qp,dim) = ScalarT(num_dof, this->val_node(cell, 0).val() * this->GradBF(cell, 0, qp, dim));
-            (this->grad_val_qp(cell,qp,dim)).fastAccessDx(offset) = this->val_node(cell, 0).fastAccessDx(offset) * this->GradBF(cell, 0, qp, dim);
+            if (jacPass.isCol(offset,neq))
+              (this->grad_val_qp(cell,qp,dim)).fastAccessDx(jacPass.slot(0,offset,neq)) = this->val_node(cell, 0).fastAccessDx(jacPass.slot(0,offset,neq)) * this->GradBF(cell, 0, qp, dim);
             for (std::size_t node= 1 ; node < this->numNodes; ++node) {
               (this->grad_val_qp(cell,qp,dim)).val() += this->val_node(cell, node).val() * this->GradBF(cell, node, qp, dim);
-              (this->grad_val_qp(cell,qp,dim)).fastAccessDx(neq*node+offset) += this->val_node(cell, node).fastAccessDx(neq*node+offset) * this->GradBF(cell, node, qp, dim);
+              if (jacPass.isCol(offset,neq))
+                (this->grad_val_qp(cell,qp,dim)).fastAccessDx(jacPass.slot(node,offset,neq)) += this->val_node(cell, node).fastAccessDx(jacPass.slot(node,offset,neq)) * this->GradBF(cell, node, qp, dim);
           }
         }
       }
@@ -223,6 +232,7 @@ evaluateFields(typename Traits::EvalData workset)
 
  num_dof = this->val_node(0,0).size();
  neq = workset.wsElNodeEqID.extent(2);
+ jacPass = workset.jacobian_pass;
 
  Kokkos::parallel_for(FastSolutionGradInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
 
@@ -7,6 +7,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -88,6 +89,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFInterpolationSideBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSetViews->find(sideSetName)==workset.sideSetViews->end())
     return;
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
@@ -9,6 +9,7 @@
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
 #include "PHAL_Workset.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -66,6 +67,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFInterpolationBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   //Intrepid2 version:
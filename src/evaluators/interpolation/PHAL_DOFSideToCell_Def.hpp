@@ -10,6 +10,7 @@
 
 #include "PHAL_DOFSideToCell.hpp"
 #include "Albany_DiscretizationUtils.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -124,6 +125,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFSideToCellBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
     return;
 
@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -52,6 +53,8 @@ namespace PHAL {
   void DOFTensorGradInterpolationBase<EvalT, Traits, ScalarT>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < numQPs; ++qp) {
         for (std::size_t i=0; i<vecDim; i++) {
@@ -78,8 +81,11 @@ namespace PHAL {
   void FastSolutionTensorGradInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
     const int num_dof = this->val_node(0,0,0,0).size();
     const int neq = workset.wsElNodeEqID.extent(2);
+    const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
     const auto vecDim = this->vecDim;
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < this->numQPs; ++qp) {
@@ -89,11 +95,13 @@ namespace PHAL {
               // For node==0, overwrite. Then += for 1 to numNodes.
               typename PHAL::Ref<ScalarT>::type gvqp = this->grad_val_qp(cell,qp,i,j,dim);
               gvqp = ScalarT(num_dof, this->val_node(cell, 0, i, j).val() * this->GradBF(cell, 0, qp, dim));
-              gvqp.fastAccessDx(offset+i*vecDim+j) = this->val_node(cell, 0, i, j).fastAccessDx(offset+i*vecDim+j) * this->GradBF(cell, 0, qp, dim);
+              if (jacPass.isCol(offset+i*vecDim+j,neq))
+                gvqp.fastAccessDx(jacPass.slot(0,offset+i*vecDim+j,neq)) = this->val_node(cell, 0, i, j).fastAccessDx(jacPass.slot(0,offset+i*vecDim+j,neq)) * this->GradBF(cell, 0, qp, dim);
               for (std::size_t node= 1 ; node < this->numNodes; ++node) {
                 gvqp.val() += this->val_node(cell, node, i, j).val() * this->GradBF(cell, node, qp, dim);
-                gvqp.fastAccessDx(neq*node+offset+i*vecDim+j)
-                  += this->val_node(cell, node, i, j).fastAccessDx(neq*node+offset+i*vecDim+j) * this->GradBF(cell, node, qp, dim);
+                if (jacPass.isCol(offset+i*vecDim+j,neq))
+                  gvqp.fastAccessDx(jacPass.slot(node,offset+i*vecDim+j,neq))
+                    += this->val_node(cell, node, i, j).fastAccessDx(jacPass.slot(node,offset+i*vecDim+j,neq)) * this->GradBF(cell, node, qp, dim);
               }
             }
           }
@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -50,6 +51,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFTensorInterpolationBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < numQPs; ++qp) {
       for (std::size_t i=0; i<vecDim; i++) {
@@ -74,8 +77,11 @@ template<typename Traits>
 void FastSolutionTensorInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   const int num_dof = this->val_node(0,0,0,0).size();
   const int neq = workset.wsElNodeEqID.extent(2);
+  const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
   const auto vecDim = this->vecDim;
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < this->numQPs; ++qp) {
@@ -86,11 +92,13 @@ evaluateFields(typename Traits::EvalData workset)
 
           vqp = this->val_node(cell, 0, i, j) * this->BF(cell, 0, qp);
           vqp = ScalarT(num_dof, this->val_node(cell, 0, i, j).val() * this->BF(cell, 0, qp));
-          vqp.fastAccessDx(offset+i*vecDim+j) = this->val_node(cell, 0, i, j).fastAccessDx(offset+i*vecDim+j) * this->BF(cell, 0, qp);
+          if (jacPass.isCol(offset+i*vecDim+j,neq))
+            vqp.fastAccessDx(jacPass.slot(0,offset+i*vecDim+j,neq)) = this->val_node(cell, 0, i, j).fastAccessDx(jacPass.slot(0,offset+i*vecDim+j,neq)) * this->BF(cell, 0, qp);
           for (std::size_t node=1; node < this->numNodes; ++node) {
             vqp.val() += this->val_node(cell, node, i, j).val() * this->BF(cell, node, qp);
-            vqp.fastAccessDx(neq*node+offset+i*this->vecDim+j)
-              += this->val_node(cell, node, i, j).fastAccessDx(neq*node+offset+i*vecDim+j) * this->BF(cell, node, qp);
+            if (jacPass.isCol(offset+i*vecDim+j,neq))
+              vqp.fastAccessDx(jacPass.slot(node,offset+i*vecDim+j,neq))
+                += this->val_node(cell, node, i, j).fastAccessDx(jacPass.slot(node,offset+i*vecDim+j,neq)) * this->BF(cell, node, qp);
           }
         }
       }
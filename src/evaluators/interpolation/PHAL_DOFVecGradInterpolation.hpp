@@ -144,6 +144,7 @@ public:
   void operator() (const FastSolutionVecGradInterpolationBase_Jacobian_Tag& tag, const int& cell) const;
 
   int num_dof, neq;
+  PHAL::JacobianPass jacPass;
 
 #endif
 };
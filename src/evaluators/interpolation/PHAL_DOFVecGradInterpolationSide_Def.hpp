@@ -6,6 +6,7 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL
 {
@@ -51,6 +52,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFVecGradInterpolationSideBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
     return;
 
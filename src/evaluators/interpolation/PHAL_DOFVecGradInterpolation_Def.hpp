@@ -11,6 +11,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -85,6 +86,8 @@ namespace PHAL {
   void DOFVecGradInterpolationBase<EvalT, Traits, ScalarT>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
     if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
@@ -136,10 +139,12 @@ namespace PHAL {
             for (int dim=0; dim<this->numDims; dim++) {
               // For node==0, overwrite. Then += for 1 to numNodes.
               this->grad_val_qp(cell,qp,i,dim) = ScalarT(num_dof, this->val_node(cell, 0, i).val() * this->GradBF(cell, 0, qp, dim));
-              (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(offset+i) = this->val_node(cell, 0, i).fastAccessDx(offset+i) * this->GradBF(cell, 0, qp, dim);
+              if (jacPass.isCol(offset+i,neq))
+                (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(jacPass.slot(0,offset+i,neq)) = this->val_node(cell, 0, i).fastAccessDx(jacPass.slot(0,offset+i,neq)) * this->GradBF(cell, 0, qp, dim);
               for (int node= 1 ; node < this->numNodes; ++node) {
                 (this->grad_val_qp(cell,qp,i,dim)).val() += this->val_node(cell, node, i).val() * this->GradBF(cell, node, qp, dim);
-                (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(neq*node+offset+i) += this->val_node(cell, node, i).fastAccessDx(neq*node+offset+i) * this->GradBF(cell, node, qp, dim);
+                if (jacPass.isCol(offset+i,neq))
+                  (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(jacPass.slot(node,offset+i,neq)) += this->val_node(cell, node, i).fastAccessDx(jacPass.slot(node,offset+i,neq)) * this->GradBF(cell, node, qp, dim);
            }
          }
         }
@@ -152,19 +157,24 @@ namespace PHAL {
   void FastSolutionVecGradInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
   evaluateFields(typename Traits::EvalData workset)
   {
+    PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
     const int num_dof = this->val_node(0,0,0).size();
     const int neq = workset.wsElNodeEqID.extent(2);
+    const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
         for (std::size_t qp=0; qp < this->numQPs; ++qp) {
           for (std::size_t i=0; i<this->vecDim; i++) {
             for (std::size_t dim=0; dim<this->numDims; dim++) {
               // For node==0, overwrite. Then += for 1 to numNodes.
               this->grad_val_qp(cell,qp,i,dim) = ScalarT(num_dof, this->val_node(cell, 0, i).val() * this->GradBF(cell, 0, qp, dim));
-              (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(offset+i) = this->val_node(cell, 0, i).fastAccessDx(offset+i) * this->GradBF(cell, 0, qp, dim);
+              if (jacPass.isCol(offset+i,neq))
+                (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(jacPass.slot(0,offset+i,neq)) = this->val_node(cell, 0, i).fastAccessDx(jacPass.slot(0,offset+i,neq)) * this->GradBF(cell, 0, qp, dim);
               for (std::size_t node= 1 ; node < this->numNodes; ++node) {
                 (this->grad_val_qp(cell,qp,i,dim)).val() += this->val_node(cell, node, i).val() * this->GradBF(cell, node, qp, dim);
-                (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(neq*node+offset+i) += this->val_node(cell, node, i).fastAccessDx(neq*node+offset+i) * this->GradBF(cell, node, qp, dim);
+                if (jacPass.isCol(offset+i,neq))
+                  (this->grad_val_qp(cell,qp,i,dim)).fastAccessDx(jacPass.slot(node,offset+i,neq)) += this->val_node(cell, node, i).fastAccessDx(jacPass.slot(node,offset+i,neq)) * this->GradBF(cell, node, qp, dim);
            }
          }
         }
@@ -179,6 +189,7 @@ namespace PHAL {
 
    num_dof = this->val_node(0,0,0).size();
    neq = workset.wsElNodeEqID.extent(2);
+   jacPass = workset.jacobian_pass;
 
    Kokkos::parallel_for(FastSolutionVecGradInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
 
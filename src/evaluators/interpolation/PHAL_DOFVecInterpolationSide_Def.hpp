@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -93,6 +94,8 @@ template<typename EvalT, typename Traits, typename Type>
 void DOFVecInterpolationSideBase<EvalT, Traits, Type>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSetViews->find(sideSetName)==workset.sideSetViews->end())
     return;
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
@@ -10,6 +10,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -94,6 +95,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFVecInterpolationBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
@@ -148,6 +151,8 @@ class VecInterpolationJacob {
  const int vecDims_;
  const int num_dof_;
  const int offset_;
+ const int neq_;
+ const PHAL::JacobianPass jacPass_;
 
  public:
  typedef Device device_type;
@@ -159,7 +164,9 @@ class VecInterpolationJacob {
                          int numQPs,
                          int vecDims,
                          int num_dof,
-                         int offset)
+                         int offset,
+                         int neq,
+                         const PHAL::JacobianPass& jacPass)
   : BF_(BF)
   , val_node_(val_node)
   , U_(U)
@@ -167,19 +174,22 @@ class VecInterpolationJacob {
   , numQPs_(numQPs)
   , vecDims_(vecDims)
   , num_dof_(num_dof)
-  , offset_(offset){}
+  , offset_(offset)
+  , neq_(neq)
+  , jacPass_(jacPass){}
 
  KOKKOS_INLINE_FUNCTION
  void operator () (const int i) const
  {
-   const int neq = num_dof_ / numNodes_;
    for (int qp=0; qp < numQPs_; ++qp) {
       for (int vec=0; vec<vecDims_; vec++) {
            U_(i,qp,vec) = ScalarT(num_dof_, val_node_(i, 0, vec).val() * BF_(i, 0, qp));
-          (U_(i,qp,vec)).fastAccessDx(offset_+vec) = val_node_(i, 0, vec).fastAccessDx(offset_+vec) * BF_(i, 0, qp);
+          if (jacPass_.isCol(offset_+vec,neq_))
+            (U_(i,qp,vec)).fastAccessDx(jacPass_.slot(0,offset_+vec,neq_)) = val_node_(i, 0, vec).fastAccessDx(jacPass_.slot(0,offset_+vec,neq_)) * BF_(i, 0, qp);
            for (int node=1; node < numNodes_; ++node) {
             (U_(i,qp,vec)).val() += val_node_(i, node, vec).val() * BF_(i, node, qp);
-            (U_(i,qp,vec)).fastAccessDx(neq*node+offset_+vec) += val_node_(i, node, vec).fastAccessDx(neq*node+offset_+vec) * BF_(i, node, qp);
+            if (jacPass_.isCol(offset_+vec,neq_))
+              (U_(i,qp,vec)).fastAccessDx(jacPass_.slot(node,offset_+vec,neq_)) += val_node_(i, node, vec).fastAccessDx(jacPass_.slot(node,offset_+vec,neq_)) * BF_(i, node, qp);
            }
       }
     }
@@ -191,19 +201,24 @@ template<typename Traits>
 void FastSolutionVecInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   int num_dof = this->val_node(0,0,0).size();
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   const int neq = workset.wsElNodeEqID.extent(2);
+  const PHAL::JacobianPass& jacPass = workset.jacobian_pass;
 
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < this->numQPs; ++qp) {
       for (std::size_t i=0; i<this->vecDim; i++) {
         // Zero out for node==0; then += for node = 1 to numNodes
         this->val_qp(cell,qp,i) = ScalarT(num_dof, this->val_node(cell, 0, i).val() * this->BF(cell, 0, qp));
-        (this->val_qp(cell,qp,i)).fastAccessDx(offset+i) = this->val_node(cell, 0, i).fastAccessDx(offset+i) * this->BF(cell, 0, qp);
+        if (jacPass.isCol(offset+i,neq))
+          (this->val_qp(cell,qp,i)).fastAccessDx(jacPass.slot(0,offset+i,neq)) = this->val_node(cell, 0, i).fastAccessDx(jacPass.slot(0,offset+i,neq)) * this->BF(cell, 0, qp);
         for (std::size_t node=1; node < this->numNodes; ++node) {
           (this->val_qp(cell,qp,i)).val() += this->val_node(cell, node, i).val() * this->BF(cell, node, qp);
-          (this->val_qp(cell,qp,i)).fastAccessDx(neq*node+offset+i) += this->val_node(cell, node, i).fastAccessDx(neq*node+offset+i) * this->BF(cell, node, qp);
+          if (jacPass.isCol(offset+i,neq))
+            (this->val_qp(cell,qp,i)).fastAccessDx(jacPass.slot(node,offset+i,neq)) += this->val_node(cell, node, i).fastAccessDx(jacPass.slot(node,offset+i,neq)) * this->BF(cell, node, qp);
         }
       }
     }
@@ -217,7 +232,8 @@ evaluateFields(typename Traits::EvalData workset)
         decltype(this->BF),
         decltype(this->val_node),
         decltype(this->val_qp)>(
-            this->BF, this->val_node, this->val_qp, this->numNodes, this->numQPs, this->vecDim, num_dof, offset));
+            this->BF, this->val_node, this->val_qp, this->numNodes, this->numQPs, this->vecDim, num_dof, offset,
+            workset.wsElNodeEqID.extent(2), workset.jacobian_pass));
 #endif
 
 }
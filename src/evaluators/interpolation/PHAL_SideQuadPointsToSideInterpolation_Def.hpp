@@ -9,6 +9,7 @@
 
 #include "PHAL_SideQuadPointsToSideInterpolation.hpp"
 #include "Albany_DiscretizationUtils.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -67,6 +68,8 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename EvalT, typename Traits, typename ScalarT>
 void SideQuadPointsToSideInterpolationBase<EvalT, Traits, ScalarT>::evaluateFields (typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
     return;
 
@@ -14,6 +14,8 @@
 
 namespace PHAL {
 
+template<typename EvalT, typename Traits> class Source;
+
 /** \brief Finite Element Interpolation Evaluator
 
     This evaluator interpolates nodal DOF values to quad points.
@@ -50,10 +52,14 @@ private:
   PHX::MDField<const ScalarT,Cell,QuadPoint> Absorption;
   Teuchos::Array<double> convectionVels;
 
+  //! If the source is uniform, its scalar value is used instead of the field
+  Teuchos::RCP<const PHAL::Source<EvalT,Traits>> sourceEvaluator;
+
   // Output:
   PHX::MDField<ScalarT,Cell,Node> TResidual;
 
   bool haveSource;
+  bool uniformSource;
   bool haveConvection;
   bool haveAbsorption;
   bool enableTransient;
@@ -9,6 +9,7 @@
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_Source.hpp"
 
 namespace PHAL {
 
@@ -33,6 +34,7 @@ HeatEqResid(const Teuchos::ParameterList& p) :
   TResidual   (p.get<std::string>                   ("Residual Name"),
 	       p.get<Teuchos::RCP<PHX::DataLayout> >("Node Scalar Data Layout") ),
   haveSource  (p.get<bool>("Have Source")),
+  uniformSource(false),
   haveConvection(false),
   haveAbsorption  (p.get<bool>("Have Absorption")),
   haverhoCp(false)
@@ -48,7 +50,13 @@ HeatEqResid(const Teuchos::ParameterList& p) :
   if (enableTransient) this->addDependentField(Tdot);
   this->addDependentField(TGrad);
   this->addDependentField(wGradBF);
-  if (haveSource) this->addDependentField(Source);
+  if (haveSource) {
+    this->addDependentField(Source);
+    if (p.isType<Teuchos::RCP<const PHAL::Source<EvalT,Traits>>>("Source Evaluator")) {
+      sourceEvaluator = p.get<Teuchos::RCP<const PHAL::Source<EvalT,Traits>>>("Source Evaluator");
+      uniformSource = sourceEvaluator->isUniform();
+    }
+  }
   if (haveAbsorption) {
     Absorption = decltype(Absorption)(
 	p.get<std::string>("Absorption Name"),
@@ -127,7 +135,14 @@ evaluateFields(typename Traits::EvalData workset)
 
   FST::integrate(TResidual.get_view(), flux, wGradBF.get_view(), false); // "false" overwrites
 
-  if (haveSource) {
+  if (haveSource && uniformSource) {
+    // The Source field holds the same value everywhere: integrate the scalar
+    const ScalarT neg_source = -sourceEvaluator->getUniformValue();
+    for (std::size_t cell=0; cell < workset.numCells; ++cell)
+      for (std::size_t node=0; node < numNodes; ++node)
+        for (std::size_t qp=0; qp < numQPs; ++qp)
+          TResidual(cell,node) += neg_source * wBF(cell,node,qp);
+  } else if (haveSource) {
     auto neg_source = PHAL::create_copy("neg_source", Source.get_view());
 
     for (int i =0; i< Source.extent(0); i++)
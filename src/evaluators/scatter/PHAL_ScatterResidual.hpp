@@ -203,6 +203,7 @@ private:
   void evaluateFieldsDevice(typename Traits::EvalData d);
   void evaluateFieldsHost(typename Traits::EvalData d);
   int neq, nunk, numDims;
+  PHAL::JacobianPass jacPass;
   Albany::DeviceLocalMatrix<ST> Jac_kokkos;
 
   typedef ScatterResidualBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
@@ -18,6 +18,7 @@
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 // **********************************************************************
 // Base Class Generic Implemtation
@@ -166,6 +167,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   Teuchos::RCP<Thyra_Vector> f = workset.f;
 
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
@@ -254,6 +257,7 @@ operator() (const PHAL_ScatterResRank0_Tag&, const int& cell) const
 {
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       const LO id = nodeID(cell,node,this->offset + eq);
       Kokkos::atomic_fetch_add(&f_kokkos(id), (val_kokkos[eq](cell,node)).val());
     }
@@ -275,13 +279,14 @@ operator() (const PHAL_ScatterJacRank0_Adjoint_Tag&, const int& cell) const
   }
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
-    for (int eq_col=0; eq_col<neq; eq_col++) {
-      col[neq * node_col + eq_col] =  nodeID(cell,node_col,eq_col);
+    for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+      col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       row = nodeID(cell,node,this->offset + eq);
       auto valptr = val_kokkos[eq](cell,node);
       for (int lunk=0; lunk<nunk; lunk++) {
@@ -309,13 +314,14 @@ operator() (const PHAL_ScatterJacRank0_Tag&, const int& cell) const
   }
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
-    for (int eq_col=0; eq_col<neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
+    for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+      col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       row = nodeID(cell,node,this->offset + eq);
       auto valptr = val_kokkos[eq](cell,node);
       for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
@@ -331,6 +337,7 @@ operator() (const PHAL_ScatterResRank1_Tag&, const int& cell) const
 {
   for (std::size_t node = 0; node < this->numNodes; node++) {
     for (std::size_t eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       const LO id = nodeID(cell,node,this->offset + eq);
       Kokkos::atomic_fetch_add(&f_kokkos(id), (this->valVec(cell,node,eq)).val());
     }
@@ -353,13 +360,14 @@ operator() (const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& cell) const
   }
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
-    for (int eq_col=0; eq_col<neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
+    for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+      col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       row = nodeID(cell,node,this->offset + eq);
       if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
         for (int lunk=0; lunk<nunk; lunk++){
@@ -388,13 +396,14 @@ operator() (const PHAL_ScatterJacRank1_Tag&, const int& cell) const
   }
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
-    for (int eq_col=0; eq_col<neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
+    for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+      col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       row = nodeID(cell,node,this->offset + eq);
       if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
         for (int i = 0; i < nunk; ++i) vals[i] = (this->valVec)(cell,node,eq).fastAccessDx(i);
@@ -412,6 +421,7 @@ operator() (const PHAL_ScatterResRank2_Tag&, const int& cell) const
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
+        if (!jacPass.isRow(this->offset + i*numDims + j,neq)) continue;
         const LO id = nodeID(cell,node,this->offset + i*numDims + j);
         Kokkos::atomic_fetch_add(&f_kokkos(id), (this->valTensor(cell,node,i,j)).val()); 
       }
@@ -433,13 +443,14 @@ operator() (const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& cell) const
   }
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
-    for (int eq_col=0; eq_col<neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
+    for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+      col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       row = nodeID(cell,node,this->offset + eq);
       if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
         for (int lunk=0; lunk<nunk; lunk++) {
@@ -468,13 +479,14 @@ operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const
   }
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
-    for (int eq_col=0; eq_col<neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
+    for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+      col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
+      if (!jacPass.isRow(this->offset + eq,neq)) continue;
       row = nodeID(cell,node,this->offset + eq);
       if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
         for (int i = 0; i < nunk; ++i) vals[i] = (this->valTensor)(cell,node, eq/numDims, eq%numDims).fastAccessDx(i);
@@ -490,6 +502,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   const bool use_device = Albany::build_type()==Albany::BuildType::Tpetra;
 #else
@@ -512,9 +526,11 @@ evaluateFieldsDevice(typename Traits::EvalData workset)
   // Get map for local data structures
   nodeID = workset.wsElNodeEqID;
 
-  // Get dimensions
+  // Get dimensions. Only the rows and columns of the equations of the
+  // current pass of the Jacobian fill are scattered (see PHAL::JacobianPass)
   neq = nodeID.extent(2);
-  nunk = neq*this->numNodes;
+  jacPass = workset.jacobian_pass;
+  nunk = jacPass.numColEqs(neq)*this->numNodes;
 
   // Get Kokkos vector view and local matrix
   const bool loadResid = Teuchos::nonnull(workset.f);
@@ -590,7 +606,8 @@ evaluateFieldsHost(typename Traits::EvalData workset)
   const bool loadResid = Teuchos::nonnull(f);
   Teuchos::Array<LO> col;
   neq = nodeID.extent(2);
-  nunk = neq*this->numNodes;
+  jacPass = workset.jacobian_pass;
+  nunk = jacPass.numColEqs(neq)*this->numNodes;
   col.resize(nunk);
   numDims = 0;
   if (this->tensorRank==2) {
@@ -604,12 +621,13 @@ evaluateFieldsHost(typename Traits::EvalData workset)
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0; node_col<this->numNodes; node_col++){
-      for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
-        col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
+      for (int eq_col=jacPass.col_begin; eq_col<jacPass.colEnd(neq); eq_col++) {
+        col[jacPass.slot(node_col,eq_col,neq)] = nodeID(cell,node_col,eq_col);
       }
     }
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
+        if (!jacPass.isRow(this->offset + eq,neq)) continue;
         typename PHAL::Ref<ScalarT const>::type
           valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
                     this->tensorRank == 1 ? this->valVec(cell,node,eq) :
@@ -655,6 +673,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Tangent,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_Vector> f = workset.f;
   Teuchos::RCP<Thyra_MultiVector> JV = workset.JV;
@@ -724,6 +744,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> fpV = workset.fpV;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST>> fpV_nonconst2dView = Albany::getNonconstLocalData(fpV);
@@ -792,6 +814,8 @@ template<typename Traits>
 void ScatterResidualWithExtrudedParams<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   if(workset.local_Vp[0].size() == 0) { return; } //In case the parameter has not been gathered, e.g. parameter is used only in Dirichlet conditions.
 
   auto level_it = extruded_params_levels->find(workset.dist_param_deriv_name);
@@ -886,6 +910,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   // Here we scatter the *local* response derivative
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> hess_vec_prod_f_xx = workset.hessianWorkset.overlapped_hess_vec_prod_f_xx;
@@ -965,6 +991,8 @@ template<typename Traits>
 void ScatterResidualWithExtrudedParams<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   const bool f_xx_is_active = !workset.hessianWorkset.hess_vec_prod_f_xx.is_null();
   const bool f_xp_is_active = !workset.hessianWorkset.hess_vec_prod_f_xp.is_null();
   const bool f_px_is_active = !workset.hessianWorkset.hess_vec_prod_f_px.is_null();
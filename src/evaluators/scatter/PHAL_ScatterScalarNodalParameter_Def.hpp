@@ -12,6 +12,7 @@
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -82,6 +83,8 @@ template<typename Traits>
 void ScatterScalarNodalParameter<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // TODO: find a way to abstract away from the map concept. Perhaps using Panzer::ConnManager?
@@ -125,6 +128,8 @@ template<typename Traits>
 void ScatterScalarExtruded2DNodalParameter<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Residual,workset);
+
   if (this->memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   // TODO: find a way to abstract away from the map concept. Perhaps using Panzer::ConnManager?
@@ -14,6 +14,7 @@
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 // **********************************************************************
 // Base Class Generic Implemtation
@@ -148,6 +149,8 @@ template<typename EvalT, typename Traits>
 void ScatterSideEqnResidualBase<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   buildSideSetNodeMap(workset);
 
   if (workset.sideSets->find(this->sideSetName)!=workset.sideSets->end()) {
@@ -15,6 +15,7 @@
 #include "Albany_CombineAndScatterManager.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 // **********************************************************************
 // Base Class Generic Implemtation
@@ -95,6 +96,8 @@ template<typename Traits>
 void SeparableScatterScalarResponse<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::Jacobian,workset);
+
   // Here we scatter the *local* response derivative
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> dgdx = workset.overlapped_dgdx;
@@ -256,6 +259,8 @@ template<typename Traits>
 void SeparableScatterScalarResponse<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   // Here we scatter the *local* response derivative
   Teuchos::RCP<Thyra_MultiVector> dgdp = workset.overlapped_dgdp;
 
@@ -313,6 +318,8 @@ template<typename Traits>
 void SeparableScatterScalarResponseWithExtrudedParams<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::DistParamDeriv,workset);
+
   auto level_it = extruded_params_levels->find(workset.dist_param_deriv_name);
   if(level_it == extruded_params_levels->end()) //if parameter is not extruded use usual scatter.
     return SeparableScatterScalarResponse<PHAL::AlbanyTraits::DistParamDeriv, Traits>::evaluateFields(workset);
@@ -411,6 +418,8 @@ template<typename Traits>
 void SeparableScatterScalarResponse<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   // Here we scatter the *local* response derivative
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> hess_vec_prod_g_xx = workset.hessianWorkset.overlapped_hess_vec_prod_g_xx;
@@ -581,6 +590,8 @@ template<typename Traits>
 void SeparableScatterScalarResponseWithExtrudedParams<PHAL::AlbanyTraits::HessianVec, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(PHAL::AlbanyTraits::HessianVec,workset);
+
   auto level_it = extruded_params_levels->find(workset.dist_param_deriv_name);
   if(level_it == extruded_params_levels->end()) //if parameter is not extruded use usual scatter.
     return SeparableScatterScalarResponse<PHAL::AlbanyTraits::HessianVec, Traits>::evaluateFields(workset);
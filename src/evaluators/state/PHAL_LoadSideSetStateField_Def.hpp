@@ -44,7 +44,7 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(field,fm);
 
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) memoizer.enable_memoizer(d,field);
 }
 
 template<typename EvalT, typename Traits, typename ScalarType>
@@ -37,7 +37,7 @@ void LoadStateFieldBase<EvalT, Traits, ScalarType>::postRegistrationSetup(typena
   this->utils.setFieldData(data,fm);
 
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) memoizer.enable_memoizer(d,data);
 }
 
 // **********************************************************************
@@ -78,7 +78,7 @@ void LoadStateField<EvalT, Traits>::postRegistrationSetup(typename Traits::Setup
   this->utils.setFieldData(data,fm);
 
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) memoizer.enable_memoizer(d,data);
 }
 
 // **********************************************************************
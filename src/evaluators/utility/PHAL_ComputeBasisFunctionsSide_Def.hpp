@@ -9,6 +9,8 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
+#include "PHAL_ScratchArena.hpp"
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
 
@@ -146,7 +148,12 @@ postRegistrationSetup(typename Traits::SetupData d,
   }
 
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) {
+    if (compute_normals)
+      memoizer.enable_memoizer(d,tangents,metric,metric_det,w_measure,inv_metric,BF,GradBF,normals);
+    else
+      memoizer.enable_memoizer(d,tangents,metric,metric_det,w_measure,inv_metric,BF,GradBF);
+  }
 }
 
 // *********************************************************************
@@ -311,6 +318,8 @@ template<typename EvalT, typename Traits>
 void ComputeBasisFunctionsSide<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   //TODO: use Intrepid routines as much as possible
@@ -539,12 +548,14 @@ evaluateFields(typename Traits::EvalData workset)
       int numCells_ = sideSet.numCellsOnSide(side);
       if( numCells_ == 0) continue;
 
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> normal_lengths = Kokkos::createDynRankView(sideCoordVec.get_view(),"normal_lengths", numCells_, numSideQPs);
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> normals_view = Kokkos::createDynRankView(sideCoordVec.get_view(),"normals", numCells_, numSideQPs, numCellDims);
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobian_side = Kokkos::createDynRankView(sideCoordVec.get_view(),"jacobian_side", numCells_, numSideQPs, numCellDims, numCellDims);
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide = Kokkos::createDynRankView(sideCoordVec.get_view(),"physPointsSide", numCells_, numSideQPs, numCellDims);
-      Kokkos::DynRankView<RealType, PHX::Device> refPointsSide("refPointsSide", numSideQPs, numCellDims);
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsCell = Kokkos::createDynRankView(coordVec.get_view(), "XXX", numCells_, numNodes, numCellDims);
+      // Temporaries live in the workset scratch arena
+      typedef Kokkos::DynRankView<MeshScalarT, PHX::Device> MeshScalarView;
+      MeshScalarView normal_lengths = createScratchView<MeshScalarView>(workset, sideCoordVec.get_view(), "normal_lengths", numCells_, numSideQPs);
+      MeshScalarView normals_view   = createScratchView<MeshScalarView>(workset, sideCoordVec.get_view(), "normals", numCells_, numSideQPs, numCellDims);
+      MeshScalarView jacobian_side  = createScratchView<MeshScalarView>(workset, sideCoordVec.get_view(), "jacobian_side", numCells_, numSideQPs, numCellDims, numCellDims);
+      MeshScalarView physPointsCell = createScratchView<MeshScalarView>(workset, coordVec.get_view(), "physPointsCell", numCells_, numNodes, numCellDims);
+      Kokkos::DynRankView<RealType, PHX::Device> refPointsSide =
+        createScratchView<Kokkos::DynRankView<RealType, PHX::Device>>(workset, cub_points, "refPointsSide", numSideQPs, numCellDims);
 
       for (std::size_t iCell=0; iCell < numCells_; ++iCell)
         for (std::size_t node=0; node < numNodes; ++node)
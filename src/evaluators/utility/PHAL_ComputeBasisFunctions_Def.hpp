@@ -8,6 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -80,7 +81,7 @@ postRegistrationSetup(typename Traits::SetupData d,
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
 
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) memoizer.enable_memoizer(d,weighted_measure,jacobian_det,BF,wBF,GradBF,wGradBF);
 }
 
 //**********************************************************************
@@ -88,6 +89,8 @@ template<typename EvalT, typename Traits>
 void ComputeBasisFunctions<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
 
   /** The allocated size of the Field Containers must currently
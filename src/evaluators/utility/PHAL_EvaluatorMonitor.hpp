@@ -0,0 +1,115 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_EVALUATOR_MONITOR_HPP
+#define PHAL_EVALUATOR_MONITOR_HPP
+
+#include "Albany_config.h"
+
+/*
+ * Per-evaluator instrumentation. Evaluators opt in by adding
+ *
+ *   PHAL_MONITOR_EVALUATOR(EvalT,workset);
+ *
+ * at the top of evaluateFields. Unless Albany is configured with
+ * ENABLE_EVALUATOR_TIMERS=ON, the macro expands to nothing, so there is
+ * no overhead at all. Otherwise, data is collected in the EvaluatorMonitor
+ * of util::PerformanceContext only if the monitor is enabled (see the
+ * "Report Evaluator Timers" option in the "Debug Output" sublist).
+ */
+
+#ifdef ALBANY_EVALUATOR_TIMERS
+
+#include "Albany_Memory.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_ScratchArena.hpp"
+#include "PHAL_Workset.hpp"
+#include "PerformanceContext.hpp"
+
+#include "Phalanx_Print.hpp"
+#include "Kokkos_Core.hpp"
+
+namespace PHAL {
+
+//! Number of derivative components of the evaluation type (-1 if not known)
+template<typename EvalT>
+struct EvaluatorMonitorDerivDim {
+  static int get (const Workset& /* workset */) { return -1; }
+};
+
+template<>
+struct EvaluatorMonitorDerivDim<AlbanyTraits::Residual> {
+  static int get (const Workset& /* workset */) { return 0; }
+};
+
+template<>
+struct EvaluatorMonitorDerivDim<AlbanyTraits::Jacobian> {
+  static int get (const Workset& workset) {
+    return workset.wsElNodeEqID.extent(1)*workset.wsElNodeEqID.extent(2);
+  }
+};
+
+template<>
+struct EvaluatorMonitorDerivDim<AlbanyTraits::Tangent> {
+  static int get (const Workset& workset) {
+    return workset.num_cols_x + workset.num_cols_p;
+  }
+};
+
+//! Times the enclosing scope, and records it in the EvaluatorMonitor
+template<typename EvalT>
+class EvaluatorMonitorGuard {
+public:
+  EvaluatorMonitorGuard (const std::string& name, const Workset& workset) {
+    auto& monitor = util::PerformanceContext::instance().evaluatorMonitor();
+    if (!monitor.enabled()) return;
+
+    stats    = monitor.get(PHX::print<EvalT>(), name);
+    numCells = workset.numCells;
+    derivDim = EvaluatorMonitorDerivDim<EvalT>::get(workset);
+
+    // Scratch requests the arena could not serve (allocated as regular views)
+    scratch = workset.scratch;
+    arenaFallbacks = scratch.is_null() ? 0 : scratch->numFallbacks();
+
+    // Kokkos allocations, counted by Albany_Memory (if tracked, see Main_Solve)
+    allocations = Albany::getKokkosAllocationCount();
+
+    // Kernels are asynchronous: do not charge pending work to this evaluator
+    Kokkos::fence();
+    stats->start();
+  }
+
+  ~EvaluatorMonitorGuard () {
+    if (stats.is_null()) return;
+
+    Kokkos::fence();
+    const std::size_t newFallbacks = scratch.is_null() ? 0 : scratch->numFallbacks() - arenaFallbacks;
+    const std::size_t newAllocations = Albany::getKokkosAllocationCount() - allocations;
+    stats->stop(numCells, derivDim, newFallbacks, newAllocations);
+  }
+
+private:
+  Teuchos::RCP<util::EvaluatorStats> stats;
+  Teuchos::RCP<const ScratchArena>   scratch;
+  std::size_t numCells;
+  std::size_t arenaFallbacks;
+  long long   allocations;
+  int derivDim;
+};
+
+} // namespace PHAL
+
+#define PHAL_MONITOR_EVALUATOR(EvalType,workset) \
+  PHAL::EvaluatorMonitorGuard<EvalType> phal_evaluator_monitor_guard(this->getName(),workset)
+
+#else
+
+#define PHAL_MONITOR_EVALUATOR(EvalType,workset)
+
+#endif // ALBANY_EVALUATOR_TIMERS
+
+#endif // PHAL_EVALUATOR_MONITOR_HPP
@@ -12,6 +12,7 @@
 #include "PHAL_MapToPhysicalFrameSide.hpp"
 #include "Albany_DiscretizationUtils.hpp"
 #include "Albany_ProblemUtils.hpp"
+#include "PHAL_EvaluatorMonitor.hpp"
 
 namespace PHAL {
 
@@ -73,12 +74,14 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(coords_side_qp,fm);
 
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
-  if (d.memoizer_active()) memoizer.enable_memoizer();
+  if (d.memoizer_active()) memoizer.enable_memoizer(d,coords_side_qp);
 }
 
 template<typename EvalT, typename Traits>
 void MapToPhysicalFrameSide<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  PHAL_MONITOR_EVALUATOR(EvalT,workset);
+
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end()) {
     return;
   }
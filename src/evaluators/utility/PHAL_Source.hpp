@@ -42,6 +42,13 @@ public:
 
   void evaluateFields(typename Traits::EvalData ud);
 
+  //! Whether the source is a single constant over the whole workset (e.g., Constant or Table)
+  bool isUniform() const;
+
+  //! The value of a uniform source, as of the last evaluation. Evaluators
+  //! that only need this scalar can use it instead of the cells x qp field.
+  ScalarT getUniformValue() const;
+
 private:
 
   std::vector<Source_Functions::Source_Base<EvalT,Traits>*> m_sources;
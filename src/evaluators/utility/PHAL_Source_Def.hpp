@@ -9,6 +9,8 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <array>
+#include <map>
 
 #include "Sacado_ParameterAccessor.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -34,6 +36,15 @@ public :
   virtual void DependentFields(Source<EvalT,Traits> &source, Teuchos::ParameterList& p)                     = 0;
   virtual void FieldData      (PHX::EvaluatorUtilities<EvalT,Traits> &utils, PHX::FieldManager<Traits>& fm) = 0;
   virtual void evaluateFields (typename Traits::EvalData workset)                                         = 0;
+
+  //! Whether the source takes the same value at every cell and qp of a workset
+  virtual bool isUniform () const { return false; }
+  //! The value of a uniform source in the last evaluated workset
+  virtual typename EvalT::ScalarT getUniformValue () const {
+    TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error,
+        "Error! getUniformValue called on a non-uniform source.\n");
+    return typename EvalT::ScalarT(0.0);
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -56,6 +67,8 @@ public :
 			 PHX::FieldManager<Traits>& fm);
   virtual void evaluateFields (typename Traits::EvalData workset);
   virtual ScalarT & getValue(const std::string &n) { return m_constant;};
+  virtual bool isUniform () const { return true; }
+  virtual ScalarT getUniformValue () const { return m_constant; }
 private :
   ScalarT     m_constant;
   std::size_t m_num_qp;
@@ -144,7 +157,12 @@ public :
 			 PHX::FieldManager<Traits>& fm);
   virtual void evaluateFields (typename Traits::EvalData workset);
   virtual ScalarT & getValue(const std::string &n) { return m_constant;};
+  virtual bool isUniform () const { return true; }
+  virtual ScalarT getUniformValue () const { return m_constant; }
 private :
+  //! Interpolate the time series at the given time
+  RealType interpolate (const double current_time);
+
   ScalarT     m_constant;
   std::size_t m_num_qp;
   Teuchos::ParameterList* m_source_list;
@@ -152,6 +170,14 @@ private :
   std::vector<double> time;
   std::vector<double> sourceval;
   int num_time_vals;
+
+  // All worksets of an evaluation share the same time, so we cache the
+  // last interpolated value, as well as the bracketing interval (time
+  // usually increases slowly, so the next bracket is likely the same).
+  bool     m_cache_valid;
+  double   m_cached_time;
+  RealType m_cached_value;
+  int      m_bracket;
 };
 
 template<typename EvalT,typename Traits>
@@ -201,7 +227,22 @@ Table(Teuchos::ParameterList& p) {
 
   inFile.close();
 
-  m_constant = sourceval[0];
+  TEUCHOS_TEST_FOR_EXCEPTION(num_time_vals < 1, Teuchos::Exceptions::InvalidParameter, std::endl <<
+		     "Error! No data found in tabular data file \"" << filename
+		     << "\" in source table fill" << std::endl);
+
+  // The bracket lookup (see interpolate) relies on sorted times
+  for(int i = 1; i < num_time_vals; i++)
+    TEUCHOS_TEST_FOR_EXCEPTION(time[i] <= time[i - 1], Teuchos::Exceptions::InvalidParameter, std::endl <<
+		     "Error! The times in tabular data file \"" << filename
+		     << "\" must be strictly increasing, but time " << time[i]
+		     << " follows " << time[i - 1] << "." << std::endl);
+
+  m_constant    = sourceval[0];
+  m_cache_valid = false;
+  m_cached_time = 0.0;
+  m_cached_value = sourceval[0];
+  m_bracket     = 0;
 
   // Add the factor as a Sacado-ized parameter
   Teuchos::RCP<ParamLib> paramLib = 
@@ -237,38 +278,48 @@ FieldData(PHX::EvaluatorUtilities<EvalT,Traits> &utils,
 }
 
 template<typename EvalT,typename Traits>
-void 
+RealType
 Table<EvalT,Traits>::
-evaluateFields(typename Traits::EvalData workset){
-
-  if(workset.current_time <= 0.0) // if time is uninitialized or zero, just take first value
-
-    m_constant = sourceval[0];
-
-  else { // Interpolate between time values
-
-    bool found_it = false;
-
-    for(int i = 0; i < num_time_vals - 1; i++) // Stride through time
-
-      if(workset.current_time >= time[i] && workset.current_time <= time[i + 1] ){ // Have bracketed current time
+interpolate(const double current_time){
+
+  if(current_time <= 0.0) // if time is uninitialized or zero, just take first value
+    return sourceval[0];
+
+  // Interpolate between time values. Try the last bracket first, then
+  // fall back to a binary search through the (sorted) time series.
+  const int last = num_time_vals - 1;
+  int i = m_bracket;
+  if(!(i < last && current_time >= time[i] && current_time <= time[i + 1])){
+    i = std::upper_bound(time.begin(), time.begin() + num_time_vals, current_time) - time.begin() - 1;
+    if(i == last && current_time == time[last]) // right endpoint belongs to the last interval
+      --i;
+  }
 
-        double s = (workset.current_time - time[i]) / (time[i + 1] - time[i]); // 0 \leq s \leq 1
+  TEUCHOS_TEST_FOR_EXCEPTION(i < 0 || i >= last, Teuchos::Exceptions::InvalidParameter, std::endl <<
+		     "Error! Cannot locate the current time \"" << current_time 
+		     << "\" in the time series data between the endpoints " << time[0]
+          << " and " << time[last] << "." << std::endl);
 
-        m_constant = sourceval[i] + s * (sourceval[i + 1] - sourceval[i]); // interp value corresponding to s
+  m_bracket = i;
 
-        found_it = true;
+  double s = (current_time - time[i]) / (time[i + 1] - time[i]); // 0 \leq s \leq 1
 
-        break;
+  return sourceval[i] + s * (sourceval[i + 1] - sourceval[i]); // interp value corresponding to s
+}
 
-      }
+template<typename EvalT,typename Traits>
+void 
+Table<EvalT,Traits>::
+evaluateFields(typename Traits::EvalData workset){
 
-    TEUCHOS_TEST_FOR_EXCEPTION(!found_it, Teuchos::Exceptions::InvalidParameter, std::endl <<
-		     "Error! Cannot locate the current time \"" << workset.current_time 
-		     << "\" in the time series data between the endpoints " << time[0]
-          << " and " << time[num_time_vals - 1] << "." << std::endl);
+  if(!m_cache_valid || workset.current_time != m_cached_time){
+    m_cached_value = interpolate(workset.current_time);
+    m_cached_time  = workset.current_time;
+    m_cache_valid  = true;
   }
 
+  m_constant = m_cached_value;
+
   // Loop over cells, quad points: compute Table Source Term
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
     for (std::size_t iqp=0; iqp<m_num_qp; iqp++)
@@ -997,11 +1048,22 @@ public :
   virtual void FieldData       (PHX::EvaluatorUtilities<EvalT,Traits> &utils, PHX::FieldManager<Traits>& fm);
   virtual void evaluateFields  (typename Traits::EvalData workset);
 private :
+  typedef std::array<long,3>  BinKey;
+
+  BinKey binKey (const double* x, const std::size_t num_dim) const;
+
   std::size_t                 m_num_qp;
   std::size_t                 m_num_dim;
   Wavelet_Base               *m_wavelet;
   std::vector<Spatial_Base<EvalT> * >  m_spatials;
 
+  // If m_cutoff>0, sources farther than m_cutoff from a point are ignored.
+  // Sources are binned by center in a uniform grid with bins of size m_cutoff,
+  // so that each cell only visits the bins overlapping its (enlarged) bounding box.
+  double                                       m_cutoff;
+  std::vector<Teuchos::Array<double> >         m_centers;
+  std::map<BinKey,std::vector<std::size_t> >   m_bins;
+
   Teuchos::ParameterList* m_source_list;
               PHX::MDField<ScalarT,Cell,Point>   m_pressure_source;
   PHX::MDField<const MeshScalarT,Cell,Point,Dim> coordVec;
@@ -1015,15 +1077,17 @@ bool PointSource<EvalT,Traits>::check_for_existance(Teuchos::ParameterList* sour
 
 template<typename EvalT, typename Traits>
 PointSource<EvalT,Traits>::PointSource(Teuchos::ParameterList* source_list) :
-  m_num_qp(0), m_wavelet(NULL), m_spatials(), m_source_list(source_list)
+  m_num_qp(0), m_wavelet(NULL), m_spatials(), m_cutoff(0), m_source_list(source_list)
 {
   Teuchos::ParameterList& paramList = source_list->sublist("Point",true);
   const std::size_t num  = paramList.get("Number", 0);
+  m_cutoff = paramList.get("Cutoff Radius", 0.0);
   Teuchos::ParameterList& spatial_param = paramList.sublist("Spatial",true);
   if (Gaussian<EvalT>::check_for_existance(spatial_param)) {
     for (std::size_t i=0; i<num; ++i) {
       Gaussian<EvalT> *s = new Gaussian<EvalT>(paramList,i);
       m_spatials.push_back(s);
+      m_centers.push_back(paramList.get(Albany::strint("Center",i),Teuchos::Array<double>()));
     }
   } else {
     TEUCHOS_TEST_FOR_EXCEPTION(m_spatials.empty(), std::logic_error,
@@ -1038,6 +1102,17 @@ PointSource<EvalT,Traits>::PointSource(Teuchos::ParameterList* source_list) :
                        "Point: Did not find a single wavelet component. Specify Monotone.");
   }
 }
+
+template<typename EvalT, typename Traits>
+typename PointSource<EvalT,Traits>::BinKey
+PointSource<EvalT,Traits>::binKey(const double* x, const std::size_t num_dim) const
+{
+  BinKey key = {{0, 0, 0}};
+  for (std::size_t i=0; i<num_dim; ++i) {
+    key[i] = static_cast<long>(std::floor(x[i]/m_cutoff));
+  }
+  return key;
+}
 template<typename EvalT, typename Traits>
 PointSource<EvalT,Traits>::~PointSource()
 {
@@ -1077,12 +1152,84 @@ void    PointSource<EvalT,Traits>::FieldData(PHX::EvaluatorUtilities<EvalT,Trait
   coordVec.dimensions(dims);
   m_num_qp  = dims[1];
   m_num_dim = dims[2];
+
+  // The centers must live in the same space as the mesh
+  TEUCHOS_TEST_FOR_EXCEPTION(m_num_dim<1 || m_num_dim>3, std::logic_error,
+                     "Point: The mesh dimension must be between 1 and 3, not " << m_num_dim << ".");
+  for (std::size_t i=0; i<m_centers.size(); ++i) {
+    TEUCHOS_TEST_FOR_EXCEPTION(static_cast<std::size_t>(m_centers[i].size())!=m_num_dim, std::logic_error,
+                       "Point: Center " << i << " has " << m_centers[i].size()
+                       << " coordinates, but the mesh dimension is " << m_num_dim << ".");
+  }
+
+  // Bucket the sources once and for all
+  if (m_cutoff>0) {
+    m_bins.clear();
+    for (std::size_t i=0; i<m_centers.size(); ++i) {
+      m_bins[binKey(m_centers[i].getRawPtr(),m_num_dim)].push_back(i);
+    }
+  }
 }
 
 template<typename EvalT, typename Traits>
 void PointSource<EvalT,Traits>::evaluateFields(typename Traits::EvalData workset)
 {
   const RealType time  = workset.current_time;
+
+  if (m_cutoff>0) {
+    const RealType wavelet = m_wavelet->evaluateFields(time);
+    const double cutoff_sq = m_cutoff*m_cutoff;
+    std::vector<std::size_t> candidates;
+    std::vector<MeshScalarT> coord(m_num_dim);
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+      // Bounding box of the cell qps, enlarged by the cutoff radius
+      double lo[3], hi[3];
+      for (std::size_t i=0; i<m_num_dim; ++i) {
+        lo[i] = hi[i] = Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,0,i));
+        for (std::size_t iqp=1; iqp<m_num_qp; iqp++) {
+          const double x = Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,iqp,i));
+          lo[i] = std::min(lo[i],x);
+          hi[i] = std::max(hi[i],x);
+        }
+        lo[i] -= m_cutoff;
+        hi[i] += m_cutoff;
+      }
+
+      // Gather the sources in the bins overlapping the box
+      const BinKey lo_key = binKey(lo,m_num_dim);
+      const BinKey hi_key = binKey(hi,m_num_dim);
+      candidates.clear();
+      BinKey key;
+      for (key[0]=lo_key[0]; key[0]<=hi_key[0]; ++key[0]) {
+        for (key[1]=lo_key[1]; key[1]<=hi_key[1]; ++key[1]) {
+          for (key[2]=lo_key[2]; key[2]<=hi_key[2]; ++key[2]) {
+            const auto it = m_bins.find(key);
+            if (it!=m_bins.end()) {
+              candidates.insert(candidates.end(),it->second.begin(),it->second.end());
+            }
+          }
+        }
+      }
+
+      for (std::size_t iqp=0; iqp<m_num_qp; iqp++) {
+        for (std::size_t i=0; i<m_num_dim; ++i) {
+          coord[i] = coordVec(cell,iqp,i);
+        }
+        m_pressure_source(cell,iqp) = 0;
+        for (const std::size_t s : candidates) {
+          double dist_sq = 0;
+          for (std::size_t i=0; i<m_num_dim; ++i) {
+            dist_sq += std::pow(m_centers[s][i]-Sacado::ScalarValue<MeshScalarT>::eval(coord[i]),2);
+          }
+          if (dist_sq<=cutoff_sq) {
+            m_pressure_source(cell,iqp) += wavelet*m_spatials[s]->evaluateFields(coord);
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
     for (std::size_t iqp=0; iqp<m_num_qp; iqp++) {
       std::vector<MeshScalarT> coord;
@@ -1207,6 +1354,22 @@ void Source<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   return;
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+bool Source<EvalT, Traits>::isUniform() const
+{
+  return m_sources.size()==1 && m_sources[0]->isUniform();
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+typename EvalT::ScalarT Source<EvalT, Traits>::getUniformValue() const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (!isUniform(), std::logic_error,
+      "Error! Source '" << this->getName() << "' is not uniform.\n");
+  return m_sources[0]->getUniformValue();
+}
+
 //**********************************************************************
 }
 
@@ -142,8 +142,21 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
 
   validPL->set<bool>("Use MDField Memoization", false, "Use memoization to avoid recomputing MDFields");
   validPL->set<bool>("Use MDField Memoization For Parameters", false, "Use memoization to avoid recomputing MDFields dependent on parameters");
+  validPL->set<double>("MDField Memoization Memory Budget (MB)", -1.0, "Memory per rank for storing memoized MDFields of multiple worksets (negative means unlimited)");
   validPL->set<bool>("Ignore Residual In Jacobian", false,
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
+  validPL->set<std::string>("Jacobian Operator", "Assembled",
+                     "Whether W is an assembled matrix ('Assembled') or applied through Tangent fills ('Matrix-Free')");
+  validPL->set<int>("Preconditioner Jacobian Refresh Interval", 1,
+                     "With a matrix-free Jacobian, reassemble the Jacobian used to build the preconditioner every this many preconditioner evaluations (<=0: only once)");
+  validPL->set<bool>("Cache Linear Transient Operators", false,
+                     "For transient problems affine in x and x_dot, with time-independent mass and stiffness: assemble them once, and form W and f from them. Time-dependent forcing and Dirichlet data cost one residual fill per time value");
+  validPL->set<double>("Linear Transient Operators Check Tolerance", 1e-10,
+                     "Relative tolerance used to check, after the first assembly, that the residual is affine in x and x_dot, by evaluating it at a perturbed point (negative: no check)");
+  validPL->set<Teuchos::Array<int>>("Jacobian Equation Blocks", Teuchos::Array<int>(),
+                     "First equation of each block of (contiguous) equations. The Jacobian is filled one block at a time, seeding only the derivatives w.r.t. the equations the block is coupled with");
+  validPL->set<Teuchos::Array<int>>("Jacobian Block Coupling", Teuchos::Array<int>(),
+                     "For each equation block k, the first block j<=k its residual depends on (blocks j..k are assumed coupled). Default: each block only depends on itself");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
 
@@ -94,6 +94,11 @@ class AbstractProblem {
   virtual bool
   useSDBCs() const = 0;
 
+  //! Whether all the evaluators of the problem honor PHAL::Workset::jacobian_pass,
+  //! so that the Jacobian can be filled by equation blocks
+  virtual bool
+  supportsJacobianPasses() const { return false; }
+
   //! Build the PDE instantiations, boundary conditions, and initial solution
   //! And construct the evaluators and field managers
   virtual void
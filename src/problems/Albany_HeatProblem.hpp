@@ -295,6 +295,7 @@ Albany::HeatProblem::constructEvaluators(
 
 // Check and see if a source term is specified for this problem in the main input file.
   bool problemSpecifiesASource = params->isSublist("Source Functions");
+  RCP<PHAL::Source<EvalT,AlbanyTraits> > sourceEv;
 
   if(problemSpecifiesASource){
 
@@ -311,8 +312,8 @@ Albany::HeatProblem::constructEvaluators(
       Teuchos::ParameterList& paramList = params->sublist("Source Functions");
       p->set<Teuchos::ParameterList*>("Parameter List", &paramList);
 
-      ev = rcp(new PHAL::Source<EvalT,AlbanyTraits>(*p));
-      fm0.template registerEvaluator<EvalT>(ev);
+      sourceEv = rcp(new PHAL::Source<EvalT,AlbanyTraits>(*p));
+      fm0.template registerEvaluator<EvalT>(sourceEv);
 
   }
   else if(materialDB != Teuchos::null){ // Sources can be specified in terms of materials or element blocks
@@ -333,8 +334,8 @@ Albany::HeatProblem::constructEvaluators(
         Teuchos::ParameterList& paramList = materialDB->getElementBlockSublist(meshSpecs.ebName, "Source Functions");
         p->set<Teuchos::ParameterList*>("Parameter List", &paramList);
 
-        ev = rcp(new PHAL::Source<EvalT,AlbanyTraits>(*p));
-        fm0.template registerEvaluator<EvalT>(ev);
+        sourceEv = rcp(new PHAL::Source<EvalT,AlbanyTraits>(*p));
+        fm0.template registerEvaluator<EvalT>(sourceEv);
     }
   }
 
@@ -353,6 +354,8 @@ Albany::HeatProblem::constructEvaluators(
     p->set<bool>("Have Source", haveSource);
     p->set<bool>("Have Absorption", haveAbsorption);
     p->set<string>("Source Name", "Source");
+    if (haveSource)
+      p->set<RCP<const PHAL::Source<EvalT,AlbanyTraits> > >("Source Evaluator", sourceEv);
 
     p->set<string>("ThermalConductivity Name", "ThermalConductivity");
     p->set< RCP<DataLayout> >("QP Scalar Data Layout", dl->qp_scalar);
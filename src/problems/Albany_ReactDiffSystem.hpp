@@ -38,6 +38,9 @@ namespace Albany {
     //! Get boolean telling code if SDBCs are utilized  
     virtual bool useSDBCs() const {return use_sdbcs_; }
 
+    //! Only uses the generic (pass-aware) gather, scatter and interpolation evaluators
+    virtual bool supportsJacobianPasses() const { return true; }
+
     //! Build the PDE instantiations, boundary conditions, and initial solution
     virtual void buildProblem(
       Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct> >  meshSpecs,
@@ -13,8 +13,13 @@
 namespace Albany {
 
 /*!
- * \brief Response function implementation for SG and MP functions using
- * a sampling-based scheme
+ * \brief Base class for scalar responses that are not computed by a
+ * field manager evaluation (e.g., norms or extrema of the solution).
+ *
+ * The SG and MP (sampling-based) evaluations this class used to provide
+ * were removed together with the SG/MP evaluation types, so there is no
+ * per-sample loop left here: ensemble sampling, if needed, has to be done
+ * by the analysis driver, one solve per sample.
  */
 class SamplingBasedScalarResponseFunction : public ScalarResponseFunction
 {
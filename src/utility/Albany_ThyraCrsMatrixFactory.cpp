@@ -127,6 +127,26 @@ void ThyraCrsMatrixFactory::insertGlobalIndices (const GO row, const Teuchos::Ar
   }
 }
 
+void ThyraCrsMatrixFactory::
+getInsertedGlobalIndices (std::vector<GO>& rows,
+                          std::vector<std::size_t>& offsets,
+                          std::vector<GO>& indices) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (is_filled(), std::logic_error,
+      "Error! The inserted indices are no longer available after fillComplete.\n");
+
+  rows.clear();
+  indices.clear();
+  offsets.assign(1,0);
+  rows.reserve(m_graph->temp_graph.size());
+  offsets.reserve(m_graph->temp_graph.size()+1);
+  for (const auto& it : m_graph->temp_graph) {
+    rows.push_back(it.first);
+    indices.insert(indices.end(),it.second.begin(),it.second.end());
+    offsets.push_back(indices.size());
+  }
+}
+
 void ThyraCrsMatrixFactory::fillComplete () {
 
   // We create the CrsGraph, insert indices from the temporary local graph,
@@ -4,6 +4,8 @@
 #include "Teuchos_RCP.hpp"
 #include "Albany_ThyraTypes.hpp"
 
+#include <vector>
+
 namespace Albany {
 
 /*
@@ -42,6 +44,14 @@ struct ThyraCrsMatrixFactory {
   // The actual graph is created when fillComplete is called
   void insertGlobalIndices (const GO row, const Teuchos::ArrayView<const GO>& indices);
 
+  // Copies the indices inserted so far in CRS format: the (sorted) columns of
+  // row rows[i] are indices[offsets[i]], ..., indices[offsets[i+1]-1].
+  // Can only be called before fillComplete (e.g., to store the graph, and later
+  // insert it again one row at a time, skipping the element loop).
+  void getInsertedGlobalIndices (std::vector<GO>& rows,
+                                 std::vector<std::size_t>& offsets,
+                                 std::vector<GO>& indices) const;
+
   // Fills the actual graph optimizing storage (exact count of nnz per row).
   void fillComplete ();
 
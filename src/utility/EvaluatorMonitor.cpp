@@ -0,0 +1,181 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#include "EvaluatorMonitor.hpp"
+
+#include <Teuchos_CommHelpers.hpp>
+
+#include <set>
+#include <sstream>
+
+namespace util {
+
+namespace {
+
+string join (const std::vector<string>& keys) {
+  string s;
+  for (const auto& k : keys) {
+    s += k;
+    s += '\n';
+  }
+  return s;
+}
+
+void split (const char* buf, const int size, std::set<string>& keys) {
+  string k;
+  for (int i = 0; i < size; ++i) {
+    if (buf[i] == '\n') {
+      keys.insert(k);
+      k.clear();
+    } else {
+      k += buf[i];
+    }
+  }
+}
+
+} // anonymous namespace
+
+EvaluatorMonitor::EvaluatorMonitor ()
+    : enabled_(false) {
+  title_ = "EvaluatorMonitor";
+  itemTypeLabel_ = "Evaluator";
+  itemValueLabel_ = "Time (s)";
+}
+
+string EvaluatorMonitor::getStringValue (const monitored_type& val) {
+  return to_string(static_cast<long double>(val.time()));
+}
+
+EvaluatorMonitor::GlobalStats
+EvaluatorMonitor::reduce (Teuchos::Ptr<const Teuchos::Comm<int> > comm) const {
+  const int rank   = comm->getRank();
+  const int nprocs = comm->getSize();
+
+  // Not all ranks call all evaluators (e.g., if a rank owns no cells of an
+  // element block), so first build the union of the keys on rank 0
+  std::vector<string> localKeys;
+  for (const auto& it : itemMap_)
+    localKeys.push_back(it.first);
+  string localBuf = join(localKeys);
+  int localSize = localBuf.size();
+
+  std::vector<int> sizes(nprocs,0), displs(nprocs,0);
+  Teuchos::gather<int,int>(&localSize, 1, sizes.data(), 1, 0, *comm);
+  int totSize = 0;
+  for (int p = 0; p < nprocs; ++p) {
+    displs[p] = totSize;
+    totSize += sizes[p];
+  }
+  std::vector<char> allBuf(std::max(totSize,1));
+  Teuchos::gatherv<int,char>(localBuf.data(), localSize, allBuf.data(),
+                             sizes.data(), displs.data(), 0, *comm);
+
+  std::set<string> keys;
+  string globalBuf;
+  if (rank == 0) {
+    split(allBuf.data(), totSize, keys);
+    globalBuf = join(std::vector<string>(keys.begin(), keys.end()));
+  }
+  int globalSize = globalBuf.size();
+  Teuchos::broadcast<int,int>(*comm, 0, &globalSize);
+  globalBuf.resize(globalSize);
+  Teuchos::broadcast<int,char>(*comm, 0, globalSize, &globalBuf[0]);
+  if (rank != 0) {
+    split(globalBuf.data(), globalSize, keys);
+  }
+
+  // Now reduce the stats, using the same ordering on all ranks
+  GlobalStats stats;
+  stats.keys.assign(keys.begin(), keys.end());
+  const int n = stats.keys.size();
+  std::vector<double>       time(n,0.0);
+  std::vector<counter_type> calls(n,0), cells(n,0), arenaFallbacks(n,0), allocations(n,0);
+  std::vector<int>          derivDim(n,-1);
+  for (int i = 0; i < n; ++i) {
+    auto pos = itemMap_.find(stats.keys[i]);
+    if (pos != itemMap_.end()) {
+      time[i]     = pos->second->time();
+      calls[i]    = pos->second->calls();
+      cells[i]    = pos->second->cells();
+      arenaFallbacks[i] = pos->second->arenaFallbacks();
+      allocations[i] = pos->second->allocations();
+      derivDim[i] = pos->second->derivDim();
+    }
+  }
+  stats.time.resize(n);
+  stats.calls.resize(n);
+  stats.cells.resize(n);
+  stats.arenaFallbacks.resize(n);
+  stats.allocations.resize(n);
+  stats.derivDim.resize(n);
+  if (n > 0) {
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, n, time.data(), stats.time.data());
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, n, calls.data(), stats.calls.data());
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, n, cells.data(), stats.cells.data());
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, n, arenaFallbacks.data(), stats.arenaFallbacks.data());
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, n, allocations.data(), stats.allocations.data());
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, n, derivDim.data(), stats.derivDim.data());
+  }
+
+  return stats;
+}
+
+void EvaluatorMonitor::summarize (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) {
+  if (!enabled_) return;
+
+  // Must be called on all ranks
+  const GlobalStats stats = reduce(comm);
+
+  if (comm->getRank() == 0) {
+    DisplayTable table;
+    table.addRow(string("EvalT"), itemTypeLabel_, string("Max Time (s)"),
+                 string("Calls"), string("Cells"), string("Deriv Dim"),
+                 string("Cells/s"), string("Arena Fallbacks"), string("Allocations"));
+    for (size_t i = 0; i < stats.keys.size(); ++i) {
+      const auto pos = stats.keys[i].find(separator_);
+      const double rate = stats.time[i] > 0 ? stats.cells[i] / stats.time[i] : 0.0;
+      table.addRow(stats.keys[i].substr(0,pos), stats.keys[i].substr(pos+1),
+                   stats.time[i], stats.calls[i], stats.cells[i],
+                   stats.derivDim[i], rate, stats.arenaFallbacks[i],
+                   stats.allocations[i]);
+    }
+
+    out << "Summary for " << title_ << std::endl;
+    table.write(out);
+  }
+}
+
+void EvaluatorMonitor::writeJSON (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) {
+  if (!enabled_) return;
+
+  // Must be called on all ranks
+  const GlobalStats stats = reduce(comm);
+
+  if (comm->getRank() == 0) {
+    std::stringstream json;
+    json << "{\n  \"evaluators\": [";
+    for (size_t i = 0; i < stats.keys.size(); ++i) {
+      const auto pos = stats.keys[i].find(separator_);
+      json << (i > 0 ? "," : "") << "\n    {"
+           << "\"evaluation type\": \"" << json_escape(stats.keys[i].substr(0,pos)) << "\", "
+           << "\"name\": \"" << json_escape(stats.keys[i].substr(pos+1)) << "\", "
+           << "\"max time\": " << stats.time[i] << ", "
+           << "\"calls\": " << stats.calls[i] << ", "
+           << "\"cells\": " << stats.cells[i] << ", "
+           << "\"derivative dimension\": " << stats.derivDim[i] << ", "
+           << "\"arena fallbacks\": " << stats.arenaFallbacks[i] << ", "
+           << "\"allocations\": " << stats.allocations[i] << "}";
+    }
+    json << (stats.keys.size() > 0 ? "\n  ]\n}\n" : "]\n}\n");
+    out << json.str();
+  }
+}
+
+}
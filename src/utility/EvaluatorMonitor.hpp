@@ -0,0 +1,124 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#ifndef UTIL_EVALUATORMONITOR_HPP
+#define UTIL_EVALUATORMONITOR_HPP
+
+/**
+ *  \file EvaluatorMonitor.hpp
+ *
+ *  \brief Per-evaluator, per-evaluation type timing and throughput data
+ */
+
+#include "MonitorBase.hpp"
+#include <Teuchos_Time.hpp>
+
+#include <algorithm>
+
+namespace util {
+
+class EvaluatorStats {
+public:
+
+  typedef size_t counter_type;
+
+  explicit EvaluatorStats (const string& name)
+      : name_(name), timer_(name), calls_(0), cells_(0), arenaFallbacks_(0),
+        allocations_(0), derivDim_(-1) {
+  }
+
+  void start () {
+    timer_.start(false);
+  }
+
+  //! Stop the timer, and record a call over numCells cells, during which
+  //! arenaFallbacks scratch requests did not fit in the arena, and were
+  //! allocated as regular views (see PHAL::ScratchArena), and allocations
+  //! Kokkos allocations were made.
+  void stop (counter_type numCells, int derivDim, counter_type arenaFallbacks = 0,
+             counter_type allocations = 0) {
+    timer_.stop();
+    ++calls_;
+    cells_ += numCells;
+    arenaFallbacks_ += arenaFallbacks;
+    allocations_ += allocations;
+    derivDim_ = std::max(derivDim_, derivDim);
+  }
+
+  double       time () const     { return timer_.totalElapsedTime(); }
+  counter_type calls () const    { return calls_; }
+  counter_type cells () const    { return cells_; }
+  counter_type arenaFallbacks () const { return arenaFallbacks_; }
+  counter_type allocations () const { return allocations_; }
+  int          derivDim () const { return derivDim_; }
+
+private:
+
+  string        name_;
+  Teuchos::Time timer_;
+  counter_type  calls_;
+  counter_type  cells_;
+  counter_type  arenaFallbacks_;
+  counter_type  allocations_;
+  int           derivDim_;
+};
+
+/**
+ *  \brief Monitor collecting EvaluatorStats, keyed by evaluation type and
+ *         evaluator name.
+ *
+ *  Data is only collected if the monitor is enabled, and if Albany was
+ *  configured with ENABLE_EVALUATOR_TIMERS=ON (see PHAL_EvaluatorMonitor.hpp).
+ *  Summaries are reduced over all ranks: times are the max over ranks,
+ *  while calls, cells, arena fallbacks and allocations are summed.
+ */
+class EvaluatorMonitor : public MonitorBase<EvaluatorStats> {
+public:
+
+  EvaluatorMonitor ();
+  virtual ~EvaluatorMonitor () {};
+
+  void setEnabled (bool enabled) { enabled_ = enabled; }
+  bool enabled () const { return enabled_; }
+
+  pointer_type get (const string& evalType, const string& evalName) {
+    return (*this)[evalType + separator_ + evalName];
+  }
+
+  void summarize (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out = std::cout);
+
+  void writeJSON (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out);
+
+protected:
+
+  virtual string getStringValue (const monitored_type& val) override;
+
+  typedef EvaluatorStats::counter_type counter_type;
+
+  struct GlobalStats {
+    std::vector<string>       keys;
+    std::vector<double>       time;
+    std::vector<counter_type> calls;
+    std::vector<counter_type> cells;
+    std::vector<counter_type> arenaFallbacks;
+    std::vector<counter_type> allocations;
+    std::vector<int>          derivDim;
+  };
+
+  //! Reduce the stats over all ranks (keys are the union over all ranks)
+  GlobalStats reduce (Teuchos::Ptr<const Teuchos::Comm<int> > comm) const;
+
+  static constexpr char separator_ = '|';
+
+  bool enabled_;
+};
+}
+
+#endif  // UTIL_EVALUATORMONITOR_HPP
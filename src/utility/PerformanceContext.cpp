@@ -22,6 +22,7 @@ void PerformanceContext::summarizeAll (
   timeMonitor_.summarize(comm, out);
   counterMonitor_.summarize(comm, out);
   variableMonitor_.summarize(comm, out);
+  evaluatorMonitor_.summarize(comm, out);
 }
 
 void PerformanceContext::summarizeAll (std::ostream& out) {
@@ -18,6 +18,7 @@
 #include "TimeMonitor.hpp"
 #include "CounterMonitor.hpp"
 #include "VariableMonitor.hpp"
+#include "EvaluatorMonitor.hpp"
 
 namespace util {
 class PerformanceContext {
@@ -40,6 +41,10 @@ public:
   VariableMonitor& variableMonitor () {
     return variableMonitor_;
   }
+
+  EvaluatorMonitor& evaluatorMonitor () {
+    return evaluatorMonitor_;
+  }
   
 private:
   
@@ -48,6 +53,7 @@ private:
   TimeMonitor     timeMonitor_;
   CounterMonitor  counterMonitor_;
   VariableMonitor variableMonitor_;
+  EvaluatorMonitor evaluatorMonitor_;
 };
 }
 
@@ -9,14 +9,33 @@
 using namespace utility;
 
 StaticAllocator::StaticAllocator(std::size_t size)
-  : size_(size), buffer_(new unsigned char[size]), ptr_(buffer_)
+  : size_(size), buffer_(new unsigned char[size]), ptr_(buffer_), owner_(true)
 {
   
 }
 
+StaticAllocator::StaticAllocator(void *buffer, std::size_t size)
+  : size_(size), buffer_(static_cast<unsigned char *>(buffer)), ptr_(buffer_),
+    owner_(false)
+{
+
+}
+
 StaticAllocator::~StaticAllocator()
 {
-  delete[] buffer_;
+  if (owner_)
+    delete[] buffer_;
+}
+
+void *
+StaticAllocator::allocate(std::size_t bytes, std::size_t alignment)
+{
+  unsigned char *ret = aligned(alignment);
+  if (ret + bytes > buffer_ + size_)
+    return nullptr;
+
+  ptr_ = ret + bytes;
+  return ret;
 }
 
 void
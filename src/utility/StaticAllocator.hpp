@@ -75,18 +75,33 @@ namespace utility
   public:
     
     StaticAllocator(std::size_t size);
+
+    // Uses (but does not own) the given buffer, which may live in device memory
+    StaticAllocator(void *buffer, std::size_t size);
+
     ~StaticAllocator();
     
     template<typename T, typename... Args>
     StaticPointer<T> create(Args&&... args);
 
+    // Raw storage, aligned to alignment (a power of 2). Returns nullptr
+    // (rather than throwing) if there is not enough space left.
+    void *allocate(std::size_t bytes, std::size_t alignment);
+
     void clear();
+
+    std::size_t size() const { return size_; }
+    std::size_t used() const { return ptr_ - buffer_; }
     
   private:
     
+    // Pad ptr_ to the given alignment (a power of 2)
+    unsigned char *aligned(std::size_t alignment) const;
+
     std::size_t    size_;
     unsigned char *buffer_;
     unsigned char *ptr_;
+    bool           owner_;
   };
 
   // Allocates memory on the stack but is fixed size at compile time
@@ -223,10 +238,18 @@ namespace utility
   }
   
     
+  inline unsigned char *
+  StaticAllocator::aligned(std::size_t alignment) const
+  {
+    const std::size_t offset = used();
+    return buffer_ + ((offset + alignment - 1) & ~(alignment - 1));
+  }
+
   template<typename T, typename... Args>
   StaticPointer<T>
   StaticAllocator::create(Args&&... args)
   {
+    ptr_ = std::min(aligned(alignof(T)), buffer_ + size_);
     if (ptr_ + sizeof(T) > buffer_ + size_)
     {
 #ifdef KOKKOS_ENABLE_CUDA
@@ -18,6 +18,7 @@
 #include <string>
 #include <type_traits>
 #include <cctype>
+#include <cstdio>
 #include <algorithm>
 
 namespace util {
@@ -75,6 +76,25 @@ inline string upper_case (const string& s) {
   return s_up;
 }
 
+// Escapes quotes, backslashes and control characters, so that s can be
+// written in a JSON string
+inline string json_escape (const string& s) {
+  string escaped;
+  for (const char c : s) {
+    if (c=='"' || c=='\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char code[8];
+      std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+      escaped += code;
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
 /*
  template<typename T>
  inline string to_string (const T& val) {
@@ -0,0 +1,27 @@
+# Run Albany on two inputs that must assemble the same Jacobian (written with
+# 'Write Jacobian to MatrixMarket'), and compare the first Jacobian of each run.
+
+foreach(INPUT ${INPUT_A} ${INPUT_B})
+  message("Running the command:")
+  message("${TEST_PROG} " " ${INPUT}")
+
+  FILE(REMOVE jac-000.mm)
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${INPUT}
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run on ${INPUT}: test failed")
+  endif()
+  if(NOT EXISTS jac-000.mm)
+    message(FATAL_ERROR "${INPUT} did not write the Jacobian: test failed")
+  endif()
+
+  FILE(RENAME jac-000.mm ${INPUT}.jac-000.mm)
+endforeach()
+
+EXECUTE_PROCESS(COMMAND ${CMAKE_COMMAND} -E compare_files
+                ${INPUT_A}.jac-000.mm ${INPUT_B}.jac-000.mm
+                RESULT_VARIABLE HAD_ERROR)
+if(HAD_ERROR)
+  message(FATAL_ERROR "The two runs assembled different Jacobians: test failed")
+endif()
@@ -0,0 +1,40 @@
+# Run Albany with a "Performance Tests" sublist, which checks two timers
+# Albany always has, and one missing timer whose name needs escaping in JSON.
+# The run must report exactly one failure (the missing timer), and write
+# a valid JSON file, with the name of the missing timer preserved.
+
+FILE(REMOVE ${JSON_FILE})
+
+message("Running the command:")
+message("${TEST_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                OUTPUT_VARIABLE TEST_OUTPUT
+                RESULT_VARIABLE HAD_ERROR)
+message("${TEST_OUTPUT}")
+
+if(NOT TEST_OUTPUT MATCHES "CheckPerformanceTestResults: Number of Comparisons Attempted = 3, Number of Failures = 1")
+  message(FATAL_ERROR "Unexpected performance test results: test failed")
+endif()
+
+if(NOT EXISTS ${JSON_FILE})
+  message(FATAL_ERROR "${JSON_FILE} was not written: test failed")
+endif()
+FILE(READ ${JSON_FILE} JSON)
+message("${JSON}")
+
+string(FIND "${JSON}" [=["name": "Missing \"quoted\" \\ timer"]=] POS)
+if(POS EQUAL -1)
+  message(FATAL_ERROR "The name of the missing timer is not escaped: test failed")
+endif()
+
+# Check that the file parses, if this cmake can read JSON
+if(NOT CMAKE_VERSION VERSION_LESS 3.19)
+  string(JSON NAME ERROR_VARIABLE JSON_ERROR GET "${JSON}" timers 2 name)
+  if(JSON_ERROR)
+    message(FATAL_ERROR "${JSON_FILE} is not valid JSON (${JSON_ERROR}): test failed")
+  endif()
+  if(NOT NAME STREQUAL [=[Missing "quoted" \ timer]=])
+    message(FATAL_ERROR "Unexpected name of the missing timer (${NAME}): test failed")
+  endif()
+endif()
@@ -0,0 +1,27 @@
+# Run Albany twice with the same input, which enables the setup cache:
+# the first run must write the cache, and the second one must read it back.
+
+FILE(GLOB OLD_CACHE_FILES ${CACHE_PREFIX}.*.bin)
+if(OLD_CACHE_FILES)
+  FILE(REMOVE ${OLD_CACHE_FILES})
+endif()
+
+foreach(RUN written read)
+  message("Running the command:")
+  message("${TEST_PROG} " " ${TEST_ARGS}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                  OUTPUT_VARIABLE TEST_OUTPUT
+                  RESULT_VARIABLE HAD_ERROR)
+  message("${TEST_OUTPUT}")
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run: test failed")
+  endif()
+
+  foreach(DATA "Jacobian graph" "side sets")
+    if(NOT TEST_OUTPUT MATCHES "${DATA} ${RUN} (to|from) setup cache")
+      message(FATAL_ERROR "The ${DATA} were not ${RUN} (setup cache): test failed")
+    endif()
+  endforeach()
+endforeach()
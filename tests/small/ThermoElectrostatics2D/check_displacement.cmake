@@ -0,0 +1,28 @@
+# Run Albany with the solution output as a displacement of the reference mesh,
+# then check that the displacement field is in the Exodus output.
+
+message("Running the command:")
+message("${TEST_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Albany didn't run: test failed")
+endif()
+
+# The summary of exodiff lists the variables of the file
+EXECUTE_PROCESS(COMMAND ${EXODIFF} -summary ${EXO_FILE}
+                OUTPUT_VARIABLE SUMMARY
+                RESULT_VARIABLE HAD_ERROR)
+message("${SUMMARY}")
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "exodiff couldn't read ${EXO_FILE}: test failed")
+endif()
+
+foreach(COMPONENT displacement_x displacement_y)
+  if(NOT SUMMARY MATCHES "${COMPONENT}")
+    message(FATAL_ERROR "${COMPONENT} is not in ${EXO_FILE}: test failed")
+  endif()
+endforeach()
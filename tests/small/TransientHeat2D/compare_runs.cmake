@@ -0,0 +1,29 @@
+# Run Albany on two inputs that must give the same solution (e.g., with and
+# without an optimization), and compare the mean value of the final solution.
+
+foreach(INPUT ${INPUT_A} ${INPUT_B})
+  message("Running the command:")
+  message("${TEST_PROG} " " ${INPUT}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${INPUT}
+                  OUTPUT_VARIABLE TEST_OUTPUT
+                  RESULT_VARIABLE HAD_ERROR)
+  message("${TEST_OUTPUT}")
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run on ${INPUT}: test failed")
+  endif()
+
+  STRING(REGEX MATCH "MeanValue of final solution ([^\n]*)" MEAN_LINE "${TEST_OUTPUT}")
+  if(NOT MEAN_LINE)
+    message(FATAL_ERROR "No final solution mean value in the output of ${INPUT}: test failed")
+  endif()
+  LIST(APPEND MEAN_VALUES ${CMAKE_MATCH_1})
+endforeach()
+
+LIST(GET MEAN_VALUES 0 MEAN_A)
+LIST(GET MEAN_VALUES 1 MEAN_B)
+message("Mean value of the final solution: ${MEAN_A} (${INPUT_A}), ${MEAN_B} (${INPUT_B})")
+if(NOT MEAN_A STREQUAL MEAN_B)
+  message(FATAL_ERROR "The two runs gave different solutions: test failed")
+endif()
@@ -0,0 +1,214 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Phalanx_DataLayout_MDALayout.hpp"
+#include "Phalanx_FieldTag_Tag.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Phalanx_Print.hpp"
+#include "Phalanx_ExtentTraits.hpp"
+#include "Phalanx_Evaluator_UnmanagedFieldDummy.hpp"
+#include "Phalanx_Evaluator_UnitTester.hpp"
+#include "Phalanx_MDField_UnmanagedAllocator.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+#include <cmath>
+#include <vector>
+
+PHX_EXTENT(CELL)
+PHX_EXTENT(QP)
+PHX_EXTENT(DIM)
+
+// requires the dim tags defined above
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Source.hpp"
+#include "Albany_Layouts.hpp"
+#include "Albany_Utils.hpp"
+
+namespace {
+
+// Builds a Source evaluator with a Gaussian point source at each of the
+// given centers. If cutoff>0, sources are binned.
+Teuchos::RCP<PHAL::Source<PHAL::AlbanyTraits::Residual,PHAL::AlbanyTraits>>
+createPointSource (Teuchos::ParameterList& source_list,
+                   const Teuchos::RCP<Albany::Layouts>& dl,
+                   const std::vector<Teuchos::Array<double>>& centers,
+                   const double radius, const double cutoff)
+{
+  Teuchos::ParameterList& point = source_list.sublist("Point");
+  point.set("Number", static_cast<int>(centers.size()));
+  point.set("Cutoff Radius", cutoff);
+  point.sublist("Time Wavelet").set<std::string>("Type", "Monotone");
+  point.sublist("Spatial").set<std::string>("Type", "Gaussian");
+  point.sublist("Spatial").set("Amplitude", 2.0);
+  point.sublist("Spatial").set("Radius", radius);
+  for (std::size_t i=0; i<centers.size(); ++i) {
+    point.set(Albany::strint("Center",i), centers[i]);
+  }
+
+  Teuchos::ParameterList p("Point Source Unit Test");
+  p.set<Teuchos::ParameterList*>("Parameter List", &source_list);
+  p.set<std::string>("Pressure Source Name", "Source");
+  p.set<std::string>("QP Coordinate Vector Name", "Coord Vec");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("QP Scalar Data Layout", dl->qp_scalar);
+  p.set< Teuchos::RCP<PHX::DataLayout> >("QP Vector Data Layout", dl->qp_vector);
+
+  return Teuchos::rcp(new PHAL::Source<PHAL::AlbanyTraits::Residual,PHAL::AlbanyTraits>(p));
+}
+
+} // anonymous namespace
+
+/**
+* pointSourceBinning test
+*
+* Checks that the binned evaluation of Gaussian point sources matches the
+* brute-force one (and a direct evaluation of the sum of the Gaussians),
+* up to the (negligible) contribution of the sources beyond the cutoff radius.
+* The mesh is a 2x2x2 grid of unit cubes, with 8 points per cell.
+*/
+TEUCHOS_UNIT_TEST(evaluator_unit_tester, pointSourceBinning)
+{
+  using namespace PHX;
+
+  using EvalType = PHAL::AlbanyTraits::Residual;
+  using Scalar = EvalType::ScalarT;
+
+  const int numCells   = 8;
+  const int numQPs     = 8;
+  const int numDim     = 3;
+  const int numRandom  = 200;
+  const double radius  = 0.1;
+  const double cutoff  = 8*radius;
+
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(numCells, 8, 8, numQPs, numDim));
+
+  MDField<RealType,CELL,QP,DIM> coord_vec =
+      allocateUnmanagedMDField<RealType,CELL,QP,DIM>("Coord Vec", dl->qp_vector);
+  for (int cell=0; cell<numCells; ++cell) {
+    for (int qp=0; qp<numQPs; ++qp) {
+      for (int d=0; d<numDim; ++d) {
+        const int cell_offset = (cell >> d) & 1;
+        const int qp_offset   = (qp >> d) & 1;
+        coord_vec(cell,qp,d) = cell_offset + 0.25 + 0.5*qp_offset;
+      }
+    }
+  }
+
+  // One source close to each point (so that no value is tiny, and relative
+  // errors are meaningful), plus pseudo-random sources in [-0.5,2.5]^3
+  std::vector<Teuchos::Array<double>> centers;
+  for (int cell=0; cell<numCells; ++cell) {
+    for (int qp=0; qp<numQPs; ++qp) {
+      Teuchos::Array<double> center(numDim);
+      for (int d=0; d<numDim; ++d) {
+        center[d] = coord_vec(cell,qp,d) + 0.05;
+      }
+      centers.push_back(center);
+    }
+  }
+  unsigned int seed = 12345;
+  for (int i=0; i<numRandom; ++i) {
+    Teuchos::Array<double> center(numDim);
+    for (int d=0; d<numDim; ++d) {
+      seed = 1103515245*seed + 12345;
+      center[d] = -0.5 + 3.0*((seed/65536) % 32768)/32768.0;
+    }
+    centers.push_back(center);
+  }
+
+  Teuchos::ParameterList brute_list("Source Functions"), binned_list("Source Functions");
+  auto brute  = createPointSource(brute_list,  dl, centers, radius, 0.0);
+  auto binned = createPointSource(binned_list, dl, centers, radius, cutoff);
+
+  // Gold values: direct sum of all the Gaussians
+  MDField<Scalar,CELL,QP> gold =
+      allocateUnmanagedMDField<Scalar,CELL,QP>("Source", dl->qp_scalar);
+  const double pi = 3.1415926535897932385;
+  const double sigma_pi = 1.0/(radius*std::sqrt(2*pi));
+  for (int cell=0; cell<numCells; ++cell) {
+    for (int qp=0; qp<numQPs; ++qp) {
+      double val = 0;
+      for (const auto& center : centers) {
+        double dist_sq = 0;
+        for (int d=0; d<numDim; ++d) {
+          dist_sq += std::pow(center[d]-coord_vec(cell,qp,d),2);
+        }
+        val += 2.0*std::pow(sigma_pi,3)*std::exp(-dist_sq/(2*radius*radius));
+      }
+      gold(cell,qp) = val;
+    }
+  }
+  Kokkos::fence();
+
+  // Each value is at least exp(-0.0075/0.02) times the peak of a Gaussian, while
+  // each neglected source contributes less than exp(-32) times that peak
+  const Scalar tol = 1.0e-10;
+
+  PHAL::Setup phxSetup;
+  PHAL::Workset phxWorkset;
+  phxWorkset.numCells = numCells;
+  phxWorkset.current_time = 0.0;
+
+  PHX::EvaluatorUnitTester<EvalType, PHAL::AlbanyTraits> brute_tester;
+  brute_tester.setDependentFieldValues(coord_vec);
+  brute_tester.setEvaluatorToTest(brute);
+  brute_tester.testEvaluator(phxSetup, phxWorkset, phxWorkset, phxWorkset);
+  Kokkos::fence();
+  brute_tester.checkFloatValues2(gold, tol, success, out);
+
+  PHX::EvaluatorUnitTester<EvalType, PHAL::AlbanyTraits> binned_tester;
+  binned_tester.setDependentFieldValues(coord_vec);
+  binned_tester.setEvaluatorToTest(binned);
+  binned_tester.testEvaluator(phxSetup, phxWorkset, phxWorkset, phxWorkset);
+  Kokkos::fence();
+  binned_tester.checkFloatValues2(gold, tol, success, out);
+}
+
+/**
+* pointSourceCenterDimension test
+*
+* Checks that a point source whose center does not have as many coordinates
+* as the mesh dimension is rejected at setup, with and without binning.
+*/
+TEUCHOS_UNIT_TEST(evaluator_unit_tester, pointSourceCenterDimension)
+{
+  using namespace PHX;
+
+  using EvalType = PHAL::AlbanyTraits::Residual;
+
+  const int numCells = 1;
+  const int numQPs   = 8;
+  const int numDim   = 3;
+
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(numCells, 8, 8, numQPs, numDim));
+
+  MDField<RealType,CELL,QP,DIM> coord_vec =
+      allocateUnmanagedMDField<RealType,CELL,QP,DIM>("Coord Vec", dl->qp_vector);
+  coord_vec.deep_copy(0.5);
+  Kokkos::fence();
+
+  Teuchos::Array<double> center(2, 0.5);
+  const std::vector<Teuchos::Array<double>> centers(1, center);
+
+  PHAL::Setup phxSetup;
+  PHAL::Workset phxWorkset;
+  phxWorkset.numCells = numCells;
+  phxWorkset.current_time = 0.0;
+
+  for (const double cutoff : {0.0, 1.0}) {
+    Teuchos::ParameterList source_list("Source Functions");
+    auto source = createPointSource(source_list, dl, centers, 0.1, cutoff);
+
+    PHX::EvaluatorUnitTester<EvalType, PHAL::AlbanyTraits> tester;
+    tester.setDependentFieldValues(coord_vec);
+    tester.setEvaluatorToTest(source);
+    TEST_THROW(tester.testEvaluator(phxSetup, phxWorkset, phxWorkset, phxWorkset), std::logic_error);
+  }
+}
@@ -0,0 +1,279 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Phalanx_DataLayout_MDALayout.hpp"
+#include "Phalanx_FieldTag_Tag.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Phalanx_Print.hpp"
+#include "Phalanx_ExtentTraits.hpp"
+#include "Phalanx_Evaluator_UnmanagedFieldDummy.hpp"
+#include "Phalanx_Evaluator_UnitTester.hpp"
+#include "Phalanx_MDField_UnmanagedAllocator.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+PHX_EXTENT(CELL)
+PHX_EXTENT(NODE)
+PHX_EXTENT(QP)
+PHX_EXTENT(DIM)
+
+// requires the dim tags defined above
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Source.hpp"
+#include "PHAL_HeatEqResid.hpp"
+#include "Albany_Layouts.hpp"
+
+namespace {
+
+// Builds a Source evaluator with a Table source, reading the given
+// (time,value) pairs from a file
+Teuchos::RCP<PHAL::Source<PHAL::AlbanyTraits::Residual,PHAL::AlbanyTraits>>
+createTableSource (Teuchos::ParameterList& source_list,
+                   const Teuchos::RCP<Albany::Layouts>& dl,
+                   const std::string& filename,
+                   const std::vector<double>& times,
+                   const std::vector<double>& values)
+{
+  std::ofstream file(filename);
+  for (std::size_t i=0; i<times.size(); ++i) {
+    file << times[i] << " " << values[i] << "\n";
+  }
+  file.close();
+
+  source_list.sublist("Table").set("Filename", filename);
+
+  Teuchos::ParameterList p("Table Source Unit Test");
+  p.set<Teuchos::ParameterList*>("Parameter List", &source_list);
+  p.set<std::string>("Source Name", "Source");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("QP Scalar Data Layout", dl->qp_scalar);
+  p.set< Teuchos::RCP<ParamLib> >("Parameter Library", Teuchos::rcp(new ParamLib));
+
+  return Teuchos::rcp(new PHAL::Source<PHAL::AlbanyTraits::Residual,PHAL::AlbanyTraits>(p));
+}
+
+} // anonymous namespace
+
+/**
+* tableSourceBrackets test
+*
+* Evaluates a Table source at a sequence of times stepping forward and
+* backward across brackets (and hitting the data times exactly), and checks
+* the result against the linear interpolation of the data. The same evaluator
+* is used throughout, so the bracket cached by the previous evaluation is
+* stale most of the time.
+*/
+TEUCHOS_UNIT_TEST(evaluator_unit_tester, tableSourceBrackets)
+{
+  using namespace PHX;
+
+  using EvalType = PHAL::AlbanyTraits::Residual;
+  using Scalar = EvalType::ScalarT;
+
+  const int numCells = 2;
+  const int numQPs   = 4;
+  const int numDim   = 2;
+
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(numCells, 4, 4, numQPs, numDim));
+
+  const std::vector<double> times  = {0.0, 1.0, 2.0, 4.0, 5.0};
+  const std::vector<double> values = {1.0, 3.0, -1.0, 2.0, 0.5};
+
+  Teuchos::ParameterList source_list("Source Functions");
+  auto table = createTableSource(source_list, dl, "table_source_unit_test.dat", times, values);
+
+  const std::vector<double> eval_times = {0.5, 1.5, 4.5, 3.0, 0.25, 5.0, 2.0, 1.0, 1.0, 4.0, 0.0};
+
+  const Scalar tol = 1.0e-12;
+  for (const double t : eval_times) {
+    // Gold value: linear interpolation in the bracket containing t
+    double val = values[0];
+    for (std::size_t i=0; i+1<times.size(); ++i) {
+      if (t>=times[i] && t<=times[i+1]) {
+        val = values[i] + (t-times[i])/(times[i+1]-times[i])*(values[i+1]-values[i]);
+        break;
+      }
+    }
+
+    MDField<Scalar,CELL,QP> gold =
+        allocateUnmanagedMDField<Scalar,CELL,QP>("Source", dl->qp_scalar);
+    for (int cell=0; cell<numCells; ++cell) {
+      for (int qp=0; qp<numQPs; ++qp) {
+        gold(cell,qp) = val;
+      }
+    }
+    Kokkos::fence();
+
+    PHAL::Setup phxSetup;
+    PHAL::Workset phxWorkset;
+    phxWorkset.numCells = numCells;
+    phxWorkset.current_time = t;
+
+    PHX::EvaluatorUnitTester<EvalType, PHAL::AlbanyTraits> tester;
+    tester.setEvaluatorToTest(table);
+    tester.testEvaluator(phxSetup, phxWorkset, phxWorkset, phxWorkset);
+    Kokkos::fence();
+    out << "Time " << t << ":\n";
+    tester.checkFloatValues2(gold, tol, success, out);
+
+    // The same value is exposed as a uniform scalar
+    TEST_ASSERT(table->isUniform());
+    TEST_FLOATING_EQUALITY(table->getUniformValue(), val, tol);
+  }
+}
+
+/**
+* tableSourceUnsortedTimes test
+*
+* Checks that a Table source with times that are not strictly increasing
+* is rejected at construction.
+*/
+TEUCHOS_UNIT_TEST(evaluator_unit_tester, tableSourceUnsortedTimes)
+{
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(2, 4, 4, 4, 2));
+
+  const std::vector<double> times  = {0.0, 2.0, 1.0, 3.0};
+  const std::vector<double> values = {1.0, 2.0, 3.0, 4.0};
+
+  Teuchos::ParameterList source_list("Source Functions");
+  TEST_THROW(createTableSource(source_list, dl, "table_source_unsorted_unit_test.dat", times, values),
+             Teuchos::Exceptions::InvalidParameter);
+}
+
+/**
+* tableSourceHeatEqResid test
+*
+* Evaluates HeatEqResid with a uniform (Table) source passed as the
+* "Source Evaluator", and checks that the source term is integrated from the
+* scalar value: the Source field given to HeatEqResid is zero, so only the
+* uniform value can produce the expected residual.
+*/
+TEUCHOS_UNIT_TEST(evaluator_unit_tester, tableSourceHeatEqResid)
+{
+  using namespace PHX;
+
+  using EvalType = PHAL::AlbanyTraits::Residual;
+  using Scalar = EvalType::ScalarT;
+
+  const int numCells = 2;
+  const int numNodes = 4;
+  const int numQPs   = 4;
+  const int numDim   = 2;
+
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(numCells, numNodes, numNodes, numQPs, numDim));
+
+  const std::vector<double> times  = {0.0, 1.0};
+  const std::vector<double> values = {2.0, 4.0};
+
+  Teuchos::ParameterList source_list("Source Functions");
+  auto table = createTableSource(source_list, dl, "table_source_heat_unit_test.dat", times, values);
+
+  PHAL::Setup phxSetup;
+  PHAL::Workset phxWorkset;
+  phxWorkset.numCells = numCells;
+  phxWorkset.current_time = 0.5;
+  phxWorkset.transientTerms = false;
+
+  // Evaluate the source first, as the field manager would
+  {
+    PHX::EvaluatorUnitTester<EvalType, PHAL::AlbanyTraits> tester;
+    tester.setEvaluatorToTest(table);
+    tester.testEvaluator(phxSetup, phxWorkset, phxWorkset, phxWorkset);
+    Kokkos::fence();
+  }
+  const Scalar source_val = 3.0;
+
+  Teuchos::ParameterList p("HeatEqResid Unit Test");
+  p.set<std::string>("Weighted BF Name", "wBF");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("Node QP Scalar Data Layout", dl->node_qp_scalar);
+  p.set<std::string>("QP Variable Name", "Temperature");
+  p.set<bool>("Disable Transient", true);
+  p.set<std::string>("QP Time Derivative Variable Name", "Temperature_dot");
+  p.set<bool>("Have Source", true);
+  p.set<bool>("Have Absorption", false);
+  p.set<std::string>("Source Name", "Source");
+  p.set< Teuchos::RCP<const PHAL::Source<EvalType,PHAL::AlbanyTraits>> >("Source Evaluator", table);
+  p.set<std::string>("ThermalConductivity Name", "ThermalConductivity");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("QP Scalar Data Layout", dl->qp_scalar);
+  p.set<std::string>("Gradient QP Variable Name", "Temperature Gradient");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("QP Vector Data Layout", dl->qp_vector);
+  p.set<std::string>("Weighted Gradient BF Name", "wGrad BF");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("Node QP Vector Data Layout", dl->node_qp_vector);
+  p.set<std::string>("Residual Name", "Temperature Residual");
+  p.set< Teuchos::RCP<PHX::DataLayout> >("Node Scalar Data Layout", dl->node_scalar);
+
+  auto resid = Teuchos::rcp(new PHAL::HeatEqResid<EvalType,PHAL::AlbanyTraits>(p));
+
+  MDField<Scalar,CELL,NODE,QP> wBF =
+      allocateUnmanagedMDField<Scalar,CELL,NODE,QP>("wBF", dl->node_qp_scalar);
+  MDField<Scalar,CELL,NODE,QP,DIM> wGradBF =
+      allocateUnmanagedMDField<Scalar,CELL,NODE,QP,DIM>("wGrad BF", dl->node_qp_vector);
+  MDField<Scalar,CELL,QP> temperature =
+      allocateUnmanagedMDField<Scalar,CELL,QP>("Temperature", dl->qp_scalar);
+  MDField<Scalar,CELL,QP> thermalCond =
+      allocateUnmanagedMDField<Scalar,CELL,QP>("ThermalConductivity", dl->qp_scalar);
+  MDField<Scalar,CELL,QP,DIM> tGrad =
+      allocateUnmanagedMDField<Scalar,CELL,QP,DIM>("Temperature Gradient", dl->qp_vector);
+  MDField<Scalar,CELL,QP> source =
+      allocateUnmanagedMDField<Scalar,CELL,QP>("Source", dl->qp_scalar);
+  MDField<Scalar,CELL,NODE> gold =
+      allocateUnmanagedMDField<Scalar,CELL,NODE>("Temperature Residual", dl->node_scalar);
+
+  wGradBF.deep_copy(0.0);
+  temperature.deep_copy(0.0);
+  thermalCond.deep_copy(1.0);
+  tGrad.deep_copy(0.0);
+  source.deep_copy(0.0);
+  for (int cell=0; cell<numCells; ++cell) {
+    for (int node=0; node<numNodes; ++node) {
+      gold(cell,node) = 0.0;
+      for (int qp=0; qp<numQPs; ++qp) {
+        wBF(cell,node,qp) = 0.1*(1+cell+node+qp);
+        gold(cell,node) -= source_val*wBF(cell,node,qp);
+      }
+    }
+  }
+  Kokkos::fence();
+
+  PHX::EvaluatorUnitTester<EvalType, PHAL::AlbanyTraits> tester;
+  tester.setEvaluatorToTest(resid);
+  tester.setDependentFieldValues(wBF);
+  tester.setDependentFieldValues(wGradBF);
+  tester.setDependentFieldValues(temperature);
+  tester.setDependentFieldValues(thermalCond);
+  tester.setDependentFieldValues(tGrad);
+  tester.setDependentFieldValues(source);
+  tester.testEvaluator(phxSetup, phxWorkset, phxWorkset, phxWorkset);
+  Kokkos::fence();
+  tester.checkFloatValues2(gold, 1.0e-12, success, out);
+}
+
+/**
+* tableSourceNotUniform test
+*
+* Checks that a Source with more than one source function is not uniform,
+* and that asking for its uniform value throws.
+*/
+TEUCHOS_UNIT_TEST(evaluator_unit_tester, tableSourceNotUniform)
+{
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(2, 4, 4, 4, 2));
+
+  const std::vector<double> times  = {0.0, 1.0};
+  const std::vector<double> values = {1.0, 2.0};
+
+  Teuchos::ParameterList source_list("Source Functions");
+  source_list.sublist("Constant").set("Value", 1.0);
+  auto source = createTableSource(source_list, dl, "table_source_not_uniform_unit_test.dat", times, values);
+
+  TEST_ASSERT(!source->isUniform());
+  TEST_THROW(source->getUniformValue(), std::logic_error);
+}